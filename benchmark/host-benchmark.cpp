@@ -0,0 +1,507 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host benchmarks comparing RAJA patterns against raw loops.
+//
+// Each RAJA benchmark has a raw loop baseline doing the same work so the
+// abstraction overhead can be read off directly, and all benchmarks are run
+// over a range of problem sizes.
+//
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+// 1-d problem sizes (number of elements)
+#define HOST_BENCHMARK_1D_SIZES Range(1 << 10, 1 << 24)
+
+// 2-d problem sizes (length of each side)
+#define HOST_BENCHMARK_2D_SIZES Range(1 << 6, 1 << 12)
+
+static std::vector<double> random_vector(int N)
+{
+  std::mt19937 gen(N);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> v(N);
+  for (auto& val : v) {
+    val = dist(gen);
+  }
+  return v;
+}
+
+//
+// forall
+//
+
+static void benchmark_forall_raw(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  std::vector<double> b(N, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+  const double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < N; ++i) {
+      pa[i] += pb[i] * c;
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(benchmark_forall_raw)->HOST_BENCHMARK_1D_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_forall_raw_omp(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  std::vector<double> b(N, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+  const double c = 3.14159;
+
+  while (state.KeepRunning()) {
+#pragma omp parallel for
+    for (int i = 0; i < N; ++i) {
+      pa[i] += pb[i] * c;
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(benchmark_forall_raw_omp)->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+template <typename EXEC_POLICY>
+static void benchmark_forall(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  std::vector<double> b(N, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+  const double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, N),
+                              [=](int i) { pa[i] += pb[i] * c; });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::seq_exec)->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::loop_exec)->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::simd_exec)->HOST_BENCHMARK_1D_SIZES;
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::omp_parallel_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::omp_parallel_for_static_exec<>)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::tbb_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE(benchmark_forall, RAJA::tbb_for_static<>)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+//
+// kernel, transposing an N x N matrix
+//
+
+static void benchmark_kernel_raw(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N * N);
+  std::vector<double> out(N * N);
+  const double* pin = in.data();
+  double* pout = out.data();
+
+  while (state.KeepRunning()) {
+    for (int r = 0; r < N; ++r) {
+      for (int c = 0; c < N; ++c) {
+        pout[c * N + r] = pin[r * N + c];
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N * N);
+}
+BENCHMARK(benchmark_kernel_raw)->HOST_BENCHMARK_2D_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_kernel_raw_omp(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N * N);
+  std::vector<double> out(N * N);
+  const double* pin = in.data();
+  double* pout = out.data();
+
+  while (state.KeepRunning()) {
+#pragma omp parallel for collapse(2)
+    for (int r = 0; r < N; ++r) {
+      for (int c = 0; c < N; ++c) {
+        pout[c * N + r] = pin[r * N + c];
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N * N);
+}
+BENCHMARK(benchmark_kernel_raw_omp)->HOST_BENCHMARK_2D_SIZES;
+#endif
+
+static void benchmark_kernel_raw_tiled(benchmark::State& state)
+{
+  constexpr int TILE = 32;
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N * N);
+  std::vector<double> out(N * N);
+  const double* pin = in.data();
+  double* pout = out.data();
+
+  while (state.KeepRunning()) {
+    for (int rt = 0; rt < N; rt += TILE) {
+      for (int ct = 0; ct < N; ct += TILE) {
+        for (int r = rt; r < std::min(rt + TILE, N); ++r) {
+          for (int c = ct; c < std::min(ct + TILE, N); ++c) {
+            pout[c * N + r] = pin[r * N + c];
+          }
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N * N);
+}
+BENCHMARK(benchmark_kernel_raw_tiled)->HOST_BENCHMARK_2D_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_kernel_raw_tiled_omp(benchmark::State& state)
+{
+  constexpr int TILE = 32;
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N * N);
+  std::vector<double> out(N * N);
+  const double* pin = in.data();
+  double* pout = out.data();
+
+  while (state.KeepRunning()) {
+#pragma omp parallel for
+    for (int rt = 0; rt < N; rt += TILE) {
+      for (int ct = 0; ct < N; ct += TILE) {
+        for (int r = rt; r < std::min(rt + TILE, N); ++r) {
+          for (int c = ct; c < std::min(ct + TILE, N); ++c) {
+            pout[c * N + r] = pin[r * N + c];
+          }
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N * N);
+}
+BENCHMARK(benchmark_kernel_raw_tiled_omp)->HOST_BENCHMARK_2D_SIZES;
+#endif
+
+template <typename KERNEL_POLICY>
+static void benchmark_kernel(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N * N);
+  std::vector<double> out(N * N);
+  const double* pin = in.data();
+  double* pout = out.data();
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KERNEL_POLICY>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, N)),
+        [=](int c, int r) { pout[c * N + r] = pin[r * N + c]; });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N * N);
+}
+
+using KernelLoopPolicy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+BENCHMARK_TEMPLATE(benchmark_kernel, KernelLoopPolicy)
+    ->HOST_BENCHMARK_2D_SIZES;
+
+using KernelTilePolicy =
+    RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::tile_fixed<32>, RAJA::seq_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<32>, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+BENCHMARK_TEMPLATE(benchmark_kernel, KernelTilePolicy)
+    ->HOST_BENCHMARK_2D_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using KernelOmpCollapsePolicy =
+    RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<1, 0>,
+        RAJA::statement::Lambda<0>
+      >
+    >;
+BENCHMARK_TEMPLATE(benchmark_kernel, KernelOmpCollapsePolicy)
+    ->HOST_BENCHMARK_2D_SIZES;
+
+using KernelOmpTilePolicy =
+    RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::tile_fixed<32>, RAJA::omp_parallel_for_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<32>, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+BENCHMARK_TEMPLATE(benchmark_kernel, KernelOmpTilePolicy)
+    ->HOST_BENCHMARK_2D_SIZES;
+#endif
+
+//
+// launch, raw baselines are the forall ones above
+//
+
+template <typename LAUNCH_POLICY, typename LOOP_POLICY>
+static void benchmark_launch(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  std::vector<double> b(N, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+  const double c = 3.14159;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<LAUNCH_POLICY>;
+  using loop_policy = RAJA::expt::LoopPolicy<LOOP_POLICY>;
+
+  while (state.KeepRunning()) {
+    RAJA::expt::launch<launch_policy>(
+        RAJA::expt::HOST,
+        RAJA::expt::Grid(RAJA::expt::Teams(1), RAJA::expt::Threads(1)),
+        [=](RAJA::expt::LaunchContext ctx) {
+          RAJA::expt::loop<loop_policy>(ctx,
+                                        RAJA::RangeSegment(0, N),
+                                        [&](int i) { pa[i] += pb[i] * c; });
+        });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE2(benchmark_launch, RAJA::expt::seq_launch_t, RAJA::loop_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_launch,
+                    RAJA::expt::omp_launch_t,
+                    RAJA::omp_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+//
+// reducers
+//
+
+static void benchmark_reduce_raw(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a = random_vector(N);
+  const double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    double sum = 0.0;
+    for (int i = 0; i < N; ++i) {
+      sum += pa[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(benchmark_reduce_raw)->HOST_BENCHMARK_1D_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_reduce_raw_omp(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a = random_vector(N);
+  const double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    double sum = 0.0;
+#pragma omp parallel for reduction(+ : sum)
+    for (int i = 0; i < N; ++i) {
+      sum += pa[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(benchmark_reduce_raw_omp)->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+static void benchmark_reduce(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a = random_vector(N);
+  const double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+    RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, N),
+                              [=](int i) { sum += pa[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE2(benchmark_reduce, RAJA::loop_exec, RAJA::seq_reduce)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE2(benchmark_reduce,
+                    RAJA::loop_exec,
+                    RAJA::seq_reduce_reproducible)
+    ->HOST_BENCHMARK_1D_SIZES;
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_reduce,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE2(benchmark_reduce,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_ordered)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE2(benchmark_reduce,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_padded)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE2(benchmark_reduce,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_reproducible)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE2(benchmark_reduce, RAJA::tbb_for_exec, RAJA::tbb_reduce)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE2(benchmark_reduce,
+                    RAJA::tbb_for_exec,
+                    RAJA::tbb_reduce_reproducible)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+//
+// scan
+//
+
+static void benchmark_scan_raw(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N);
+  std::vector<double> out(N);
+
+  while (state.KeepRunning()) {
+    std::partial_sum(in.begin(), in.end(), out.begin());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(benchmark_scan_raw)->HOST_BENCHMARK_1D_SIZES;
+
+template <typename EXEC_POLICY>
+static void benchmark_scan(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N);
+  std::vector<double> out(N);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<EXEC_POLICY>(RAJA::make_span(in.data(), N),
+                                      RAJA::make_span(out.data(), N));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE(benchmark_scan, RAJA::seq_exec)->HOST_BENCHMARK_1D_SIZES;
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_scan, RAJA::omp_parallel_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE(benchmark_scan, RAJA::omp_lookback_scan_exec<>)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_scan, RAJA::tbb_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+BENCHMARK_TEMPLATE(benchmark_scan, RAJA::tbb_lookback_scan_exec<>)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+//
+// sort, the copy of the unsorted input is timed in both variants
+//
+
+static void benchmark_sort_raw(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N);
+  std::vector<double> data(N);
+
+  while (state.KeepRunning()) {
+    std::copy(in.begin(), in.end(), data.begin());
+    std::sort(data.begin(), data.end());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(benchmark_sort_raw)->HOST_BENCHMARK_1D_SIZES;
+
+template <typename EXEC_POLICY>
+static void benchmark_sort(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> in = random_vector(N);
+  std::vector<double> data(N);
+
+  while (state.KeepRunning()) {
+    std::copy(in.begin(), in.end(), data.begin());
+    RAJA::sort<EXEC_POLICY>(RAJA::make_span(data.data(), N));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::seq_exec)->HOST_BENCHMARK_1D_SIZES;
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::omp_parallel_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::tbb_for_exec)
+    ->HOST_BENCHMARK_1D_SIZES;
+#endif
+
+BENCHMARK_MAIN();
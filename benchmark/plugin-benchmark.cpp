@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Per-launch overhead of plugin dispatch.
+//
+// Each benchmark launches many tiny loops so the time per item is dominated
+// by the cost of a launch rather than the loop body. Comparing forall against
+// the raw loop gives the overhead with no plugins registered, which should be
+// a single branch per plugin call, or nothing at all when RAJA is configured
+// with RAJA_ENABLE_PLUGINS=Off.
+//
+// The last benchmark registers a plugin that does nothing. Plugins can not be
+// removed from the registry, so it has to run after the others; benchmarks run
+// in the order they are registered below.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+// lengths of the tiny loops launched by each benchmark
+#define PLUGIN_BENCHMARK_SIZES Arg(1)->Arg(16)->Arg(256)
+
+// number of launches per benchmark iteration
+static constexpr int num_launches = 1024;
+
+class NoopPlugin : public RAJA::util::PluginStrategy
+{
+};
+
+static void benchmark_launch_raw(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_launches; ++l) {
+      for (int i = 0; i < N; ++i) {
+        pa[i] += 1.0;
+      }
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_launches);
+}
+BENCHMARK(benchmark_launch_raw)->PLUGIN_BENCHMARK_SIZES;
+
+static void benchmark_launch_forall(benchmark::State& state)
+{
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_launches; ++l) {
+      RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                                   [=](int i) { pa[i] += 1.0; });
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_launches);
+}
+BENCHMARK(benchmark_launch_forall)->PLUGIN_BENCHMARK_SIZES;
+
+static void benchmark_launch_kernel(benchmark::State& state)
+{
+  using KERNEL_POL = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>;
+
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_launches; ++l) {
+      RAJA::kernel<KERNEL_POL>(
+          RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N)),
+          [=](int i) { pa[i] += 1.0; });
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_launches);
+}
+BENCHMARK(benchmark_launch_kernel)->PLUGIN_BENCHMARK_SIZES;
+
+static void benchmark_launch_forall_noop_plugin(benchmark::State& state)
+{
+  static RAJA::util::PluginRegistry::add<NoopPlugin> P(
+      "NoopPlugin", "Does nothing, measures plugin dispatch.");
+
+  const int N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  double* pa = a.data();
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_launches; ++l) {
+      RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                                   [=](int i) { pa[i] += 1.0; });
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_launches);
+}
+BENCHMARK(benchmark_launch_forall_noop_plugin)->PLUGIN_BENCHMARK_SIZES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,35 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 10000000
+
+template <typename REDUCE_POLICY>
+static void benchmark_sum(benchmark::State& state)
+{
+  double* a = new double[N];
+
+  for (int i = 0; i < N; i++) {
+    a[i] = 1.0 / (i + 1);
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) { sum += a[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  delete[] a;
+}
+
+BENCHMARK_TEMPLATE(benchmark_sum, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_sum, RAJA::omp_reduce_reproducible);
+
+BENCHMARK_MAIN();
@@ -53,6 +53,7 @@ include(CheckSymbolExists)
 check_symbol_exists(posix_memalign stdlib.h RAJA_HAVE_POSIX_MEMALIGN)
 check_symbol_exists(std::aligned_alloc stdlib.h RAJA_HAVE_ALIGNED_ALLOC)
 check_symbol_exists(_mm_malloc "" RAJA_HAVE_MM_MALLOC)
+check_symbol_exists(SYS_futex "sys/syscall.h;linux/futex.h" RAJA_HAVE_FUTEX)
 
 # Set up RAJA_ENABLE prefixed options
 set(RAJA_ENABLE_OPENMP ${ENABLE_OPENMP})
@@ -29,7 +29,9 @@ option(RAJA_DEPRECATED_TESTS "Test deprecated features" Off)
 option(RAJA_ENABLE_BOUNDS_CHECK "Enable bounds checking in RAJA::Views/Layouts" Off)
 option(RAJA_TEST_EXHAUSTIVE "Build RAJA exhaustive tests" Off)
 option(RAJA_TEST_OPENMP_TARGET_SUBSET "Build subset of RAJA OpenMP target tests when it is enabled" On)
+option(RAJA_ENABLE_PLUGINS "Call plugins from RAJA patterns, Off removes all plugin dispatch" On)
 option(RAJA_ENABLE_RUNTIME_PLUGINS "Enable support for loading plugins at runtime" Off)
+option(RAJA_ENABLE_OPENMP_IMBALANCE "Measure per-thread load balance of OpenMP loops for plugins" Off)
 option(RAJA_ENABLE_HIP_INDIRECT_FUNCTION_CALL "Enable use of device function pointers in hip backend" OFF)
 
 option(RAJA_ENABLE_DESUL_ATOMICS "Enable support of desul atomics" Off)
@@ -23,13 +23,17 @@ public:
     end_time = std::chrono::steady_clock::now();
     double elapsedMs = std::chrono::duration<double, std::milli>(end_time - start_time).count();
 
+    const char* name = p.kernel_name ? p.kernel_name : "unnamed";
+
     if (p.platform == RAJA::Platform::host)
     {
-      printf("[TimerPlugin]: Elapsed time of host kernel was %f ms\n", elapsedMs);
+      printf("[TimerPlugin]: Elapsed time of host kernel %s was %f ms for %zu iterations\n",
+             name, elapsedMs, p.num_iterations);
     }
     else
     {
-      printf("[TimerPlugin]: Elapsed time of device kernel was %f ms\n", elapsedMs);
+      printf("[TimerPlugin]: Elapsed time of device kernel %s was %f ms for %zu iterations\n",
+             name, elapsedMs, p.num_iterations);
     }
   }
 
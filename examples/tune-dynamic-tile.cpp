@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "memoryManager.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+/*
+ *  Tile Size Tuning Example
+ *
+ *  Offline search driver filling the tuning table read by
+ *  RAJA::util::tuned_tile_sizes(). A tiled matrix transpose with
+ *  tile_dynamic tile sizes is timed for a list of candidate sizes and the
+ *  fastest is stored under the kernel name, the matrix dimensions and the
+ *  current thread count. Run it with RAJA_TUNING_FILE set to keep the table,
+ *  e.g.
+ *
+ *    RAJA_TUNING_FILE=raja-tuning.txt ./tune-dynamic-tile 2000 3000
+ *
+ *  Applications then pick up the tuned sizes with the same file set. With
+ *  OpenMP enabled the host thread count of a teams launch is tuned too.
+ *
+ *  RAJA features shown:
+ *    - tile_dynamic tile sizes passed as kernel parameters
+ *    - RAJA::util::tune_tile_sizes and RAJA::expt::tune_launch_threads
+ */
+
+using tile_policy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<1, RAJA::tile_dynamic<1>, RAJA::loop_exec,
+      RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::loop_exec,
+        RAJA::statement::For<1, RAJA::loop_exec,
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >
+  >;
+
+int main(int argc, char **argv)
+{
+  std::cout << "\n\nRAJA tile size tuning example...\n";
+
+  const int N_r = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const int N_c = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+  int *A = memoryManager::allocate<int>(N_r * N_c);
+  int *At = memoryManager::allocate<int>(N_r * N_c);
+
+  RAJA::View<int, RAJA::Layout<2>> Aview(A, N_r, N_c);
+  RAJA::View<int, RAJA::Layout<2>> Atview(At, N_c, N_r);
+
+  for (int i = 0; i < N_r * N_c; ++i) {
+    A[i] = i;
+  }
+
+  auto segments = RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N_c),
+                                   RAJA::TypedRangeSegment<int>(0, N_r));
+
+  auto transpose = [=](const std::array<RAJA::Index_type, 2>& tile) {
+    RAJA::kernel_param<tile_policy>(
+        segments,
+        RAJA::make_tuple(RAJA::TileSize{tile[0]}, RAJA::TileSize{tile[1]}),
+        [=](int col, int row, RAJA::TileSize, RAJA::TileSize) {
+          Atview(col, row) = Aview(row, col);
+        });
+  };
+
+  //
+  // Search the tile sizes and store the fastest.
+  //
+  std::vector<std::array<RAJA::Index_type, 2>> candidates;
+  for (RAJA::Index_type tc : {8, 16, 32, 64, 128}) {
+    for (RAJA::Index_type tr : {8, 16, 32, 64, 128}) {
+      candidates.push_back({{tc, tr}});
+    }
+  }
+
+  auto best = RAJA::util::tune_tile_sizes("transpose", {N_r, N_c},
+                                          candidates, transpose);
+  std::cout << "\n best tile size for " << N_r << " x " << N_c << ": "
+            << best[0] << " x " << best[1] << std::endl;
+
+  //
+  // Applications look the sizes up the same way, with defaults for
+  // untuned problems.
+  //
+  auto sizes =
+      RAJA::util::tuned_tile_sizes("transpose", {N_r, N_c}, {16, 16});
+  transpose(sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  //
+  // Search the thread count of a host teams launch with one team per row.
+  //
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>;
+  using row_loop = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+  using col_loop = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+  const RAJA::expt::Teams teams(N_r);
+
+  std::vector<int> thread_candidates;
+  for (int t = 1; t <= omp_get_max_threads(); t *= 2) {
+    thread_candidates.push_back(t);
+  }
+
+  const int threads = RAJA::expt::tune_launch_threads(
+      "transpose-launch", teams, thread_candidates, [&]() {
+        RAJA::expt::launch<launch_policy>(
+            RAJA::expt::Grid(teams, RAJA::expt::Threads(),
+                             "transpose-launch"),
+            [=](RAJA::expt::LaunchContext ctx) {
+              RAJA::expt::loop<row_loop>(
+                  ctx, RAJA::TypedRangeSegment<int>(0, N_r), [&](int row) {
+                    RAJA::expt::loop<col_loop>(
+                        ctx, RAJA::TypedRangeSegment<int>(0, N_c),
+                        [&](int col) { Atview(col, row) = Aview(row, col); });
+                  });
+            });
+      });
+  std::cout << " best host launch threads: " << threads << std::endl;
+#endif
+
+  bool match = true;
+  for (int row = 0; row < N_r; ++row) {
+    for (int col = 0; col < N_c; ++col) {
+      if (Atview(col, row) != Aview(row, col)) {
+        match = false;
+      }
+    }
+  }
+  std::cout << (match ? "\n\t result -- PASS\n" : "\n\t result -- FAIL\n");
+
+  memoryManager::deallocate(A);
+  memoryManager::deallocate(At);
+
+  std::cout << "\n DONE!...\n";
+
+  return 0;
+}
@@ -23,7 +23,9 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -109,6 +111,8 @@ public:
     }
     // mark all as not owned by us
     owner.resize(num, 0);
+    m_seg_interval_begin = c.m_seg_interval_begin;
+    m_seg_interval_end = c.m_seg_interval_end;
   }
 
   //! Copy-assignment operator for index set
@@ -142,6 +146,8 @@ public:
     using std::swap;
     swap(data, other.data);
     swap(owner, other.owner);
+    swap(m_seg_interval_begin, other.m_seg_interval_begin);
+    swap(m_seg_interval_end, other.m_seg_interval_end);
   }
 
   ///
@@ -491,10 +497,20 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
 
+  //! get number of segment intervals that have been set
+  size_t getNumSegmentIntervals() const
+  {
+    return m_seg_interval_begin.size();
+  }
+
   //! get lower bound of segment identified with interval_id
   int getSegmentIntervalBegin(size_t interval_id) const
   {
@@ -595,20 +611,54 @@ public:
   using value_type = RAJA::Index_type;
 
   //! create empty TypedIndexSet
-  RAJA_INLINE TypedIndexSet() : m_len(0) {}
+  RAJA_INLINE TypedIndexSet()
+      : m_len(0),
+        m_dep_graph(nullptr),
+        m_num_dep_graph_nodes(0),
+        m_dep_graph_set(false)
+  {
+  }
 
-  //! dtor cleans up segements that we own (none)
+  //! dtor cleans up segements that we own (none) and dependency graph
   RAJA_INLINE
-  ~TypedIndexSet() {}
+  ~TypedIndexSet() { freeDependencyGraph(); }
 
-  //! Copy-constructor.
+  //! Copy-constructor (dependency graph is deep copied).
   RAJA_INLINE
   TypedIndexSet(TypedIndexSet const &c)
+      : m_dep_graph(nullptr),
+        m_num_dep_graph_nodes(0),
+        m_dep_graph_set(false)
   {
     segment_types = c.segment_types;
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+
+    if (c.m_dep_graph != nullptr) {
+      allocateDependencyGraph(c.m_num_dep_graph_nodes);
+      for (Index_type i = 0; i < m_num_dep_graph_nodes; ++i) {
+        DepGraphNode &dst = m_dep_graph[i];
+        DepGraphNode &src = c.m_dep_graph[i];
+        dst.numDepTasks() = src.numDepTasks();
+        for (int t = 0; t < src.numDepTasks(); ++t) {
+          dst.depTaskNum(t) = src.depTaskNum(t);
+        }
+        dst.semaphoreReloadValue() = src.semaphoreReloadValue();
+        dst.semaphoreValue().store(src.semaphoreValue().load());
+      }
+      m_dep_graph_set = c.m_dep_graph_set;
+    }
+  }
+
+  //! Copy-assignment operator (copy-and-swap).
+  TypedIndexSet &operator=(TypedIndexSet const &rhs)
+  {
+    if (&rhs != this) {
+      TypedIndexSet copy(rhs);
+      this->swap(copy);
+    }
+    return *this;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +669,54 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_num_dep_graph_nodes, other.m_num_dep_graph_nodes);
+    swap(m_dep_graph_set, other.m_dep_graph_set);
+  }
+
+  //!  @name Segment dependency graph methods
+  ///
+  /// Each segment in the index set may be associated with a DepGraphNode
+  /// which describes its dependencies on other segments. The graph is
+  /// used by the taskgraph segment iteration policies (e.g.,
+  /// omp_taskgraph_segit) to run a segment as soon as all of its
+  /// predecessors have completed.
+  ///
+  /// IMPORTANT: The dependency graph must be initialized after all segments
+  ///            have been added to the index set, since nodes are indexed
+  ///            by segment id.
+  ///
+
+  ///
+  /// Allocate a dependency graph node (in default state) for each segment
+  /// in the index set. Any previously defined graph is discarded.
+  ///
+  void initDependencyGraph()
+  {
+    freeDependencyGraph();
+    allocateDependencyGraph(segment_types.size());
+  }
+
+  ///
+  /// Mark the dependency graph as complete. Each node's semaphore "reload"
+  /// value must be set before this is called, since the graph resets every
+  /// node to its reload value after the node's segment executes.
+  ///
+  void finalizeDependencyGraph() { m_dep_graph_set = (m_dep_graph != nullptr); }
+
+  //! Return true if a complete dependency graph has been set up.
+  bool dependencyGraphSet() const { return m_dep_graph_set; }
+
+  ///
+  /// Return pointer to dependency graph node for given segment, or nullptr
+  /// if no graph has been initialized.
+  ///
+  /// Note: node semaphores are modified while executing a const index set,
+  ///       so nodes are always returned non-const.
+  ///
+  DepGraphNode *getDepGraphNode(size_t segid) const
+  {
+    return (m_dep_graph != nullptr) ? m_dep_graph + segid : nullptr;
   }
 
 protected:
@@ -719,6 +817,33 @@ protected:
   {
   }
 
+  //! Allocate and default-construct dependency graph nodes
+  void allocateDependencyGraph(Index_type num_nodes)
+  {
+    m_num_dep_graph_nodes = num_nodes;
+    if (num_nodes > 0) {
+      m_dep_graph = allocate_aligned_type<DepGraphNode>(
+          alignof(DepGraphNode), num_nodes * sizeof(DepGraphNode));
+      for (Index_type i = 0; i < num_nodes; ++i) {
+        new (&m_dep_graph[i]) DepGraphNode();
+      }
+    }
+  }
+
+  //! Destroy and free dependency graph nodes
+  void freeDependencyGraph()
+  {
+    if (m_dep_graph != nullptr) {
+      for (Index_type i = m_num_dep_graph_nodes; i > 0; --i) {
+        m_dep_graph[i - 1].~DepGraphNode();
+      }
+      free_aligned(m_dep_graph);
+    }
+    m_dep_graph = nullptr;
+    m_num_dep_graph_nodes = 0;
+    m_dep_graph_set = false;
+  }
+
 public:
   using iterator = Iterators::numeric_iterator<Index_type>;
 
@@ -754,6 +879,15 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Dependency graph nodes:    seg_index -> node (may be null)
+  DepGraphNode *m_dep_graph;
+
+  //! Number of nodes in dependency graph
+  Index_type m_num_dep_graph_nodes;
+
+  //! True when dependency graph has been finalized
+  bool m_dep_graph_set;
 };
 
 
@@ -84,6 +84,10 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
  *        The method chunks a fastDim x midDim x slowDim mesh into blocks that 
  *        can be dependency-scheduled, removing need for lock constructs.
  *
+ *        For 3d meshes, the index set dependency graph is also set up so
+ *        the index set can be traversed with the omp_taskgraph_segit
+ *        segment iteration policy.
+ *
  *  \param iset reference to index set generated with range segments.
  *         Method assumes index set is empty (no segments). 
  *  \param fastDim "fast" block dimension (see above).
@@ -31,6 +31,47 @@
 namespace RAJA
 {
 
+namespace dep_graph
+{
+
+///
+/// Wait strategies used by DepGraphNode::wait() and the taskgraph
+/// index set segment iteration policies.
+///
+
+///
+/// Busy-wait, issuing a CPU relax hint between polls. Lowest latency when
+/// each thread has a dedicated core.
+///
+struct spin_wait {
+};
+
+///
+/// Busy-wait, yielding the thread between polls.
+///
+struct yield_wait {
+};
+
+///
+/// Busy-wait for SpinCount polls, then block the thread in the kernel
+/// (futex, or atomic wait) until the last dependency is satisfied.
+/// Intended for oversubscribed nodes where spinning steals cores.
+///
+template <int SpinCount = 1024>
+struct park_wait {
+  static constexpr int spin_count = SpinCount;
+};
+
+///
+/// Never wait: a segment is executed by the predecessor whose satisfyOne()
+/// call released it. Requires each node to be released at most once per
+/// traversal of the graph.
+///
+struct release_inline {
+};
+
+}  // namespace dep_graph
+
 /*!
  ******************************************************************************
  *
@@ -56,7 +97,10 @@ public:
   /// Default ctor initializes node to default state.
   ///
   DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+      : m_num_dep_tasks(0),
+        m_semaphore_reload_value(0),
+        m_semaphore_value(0),
+        m_num_parked(0)
   {
   }
 
@@ -78,27 +122,72 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency.
+  ///
+  /// Returns true if this call satisfied the last outstanding dependency;
+  /// i.e., the caller released the node and may execute it directly.
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    int value = m_semaphore_value.load();
+    while (value > 0 &&
+           !m_semaphore_value.compare_exchange_weak(value, value - 1)) {
     }
+
+    const bool released = (value == 1);
+    if (released && m_num_parked.load() > 0) {
+      unpark();
+    }
+    return released;
   }
 
   ///
   /// Wait for all dependencies to be satisfied
   ///
-  void wait()
+  void wait() { wait(dep_graph::yield_wait{}); }
+
+  ///
+  /// Wait for all dependencies to be satisfied, yielding between polls
+  ///
+  void wait(dep_graph::yield_wait)
   {
     while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
       std::this_thread::yield();
     }
   }
 
+  ///
+  /// Wait for all dependencies to be satisfied, spinning between polls
+  ///
+  void wait(dep_graph::spin_wait)
+  {
+    while (m_semaphore_value > 0) {
+      cpuRelax();
+    }
+  }
+
+  ///
+  /// Wait for all dependencies to be satisfied, spinning for a bounded
+  /// number of polls before blocking the thread
+  ///
+  template <int SpinCount>
+  void wait(dep_graph::park_wait<SpinCount>)
+  {
+    for (int i = 0; i < SpinCount; ++i) {
+      if (m_semaphore_value <= 0) {
+        return;
+      }
+      cpuRelax();
+    }
+
+    ++m_num_parked;
+    int value;
+    while ((value = m_semaphore_value.load()) > 0) {
+      park(value);
+    }
+    --m_num_parked;
+  }
+
   ///
   /// Get/set the number of "forward-dependencies" for this task; i.e., the
   /// number of external tasks that cannot execute until this task completes.
@@ -118,10 +207,31 @@ public:
   void print(std::ostream& os) const;
 
 private:
+  ///
+  /// Block calling thread while semaphore value equals expected value.
+  /// May return spuriously.
+  ///
+  void park(int expected);
+
+  ///
+  /// Wake all threads blocked in park().
+  ///
+  void unpark();
+
+  static void cpuRelax()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+  }
+
   int m_dep_task[_MaxDepTasks_];
   int m_num_dep_tasks;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
+  std::atomic<int> m_num_parked;
 };
 
 }  // namespace RAJA
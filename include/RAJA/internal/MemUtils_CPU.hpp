@@ -121,6 +121,23 @@ struct FreeAlignedType : FreeAligned
   }
 };
 
+///
+/// Deleter function object for storage owned by someone else that calls the
+/// destructor for the first size objects in the storage, but does not free it.
+///
+template < typename T, typename index_type >
+struct DestroyType
+{
+  index_type size = 0;
+
+  void operator()(T* ptr)
+  {
+    for ( index_type i = size; i > 0; --i ) {
+      ptr[i-1].~T();
+    }
+  }
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -256,15 +256,17 @@ public:
   {
     {
       // ignore zero length loops
-      using std::begin; using std::end;
+      using std::begin; using std::end; using std::distance;
       if (begin(seg) == end(seg)) return;
+      m_num_iterations += static_cast<size_t>(distance(begin(seg), end(seg)));
     }
     if (m_storage.begin() == m_storage.end()) {
       // perform auto-reserve on reuse
       reserve(m_max_num_loops, m_max_storage_bytes);
     }
 
-    util::PluginContext context{util::make_context<exec_policy>()};
+    util::PluginContext context{util::make_context<exec_policy>(
+        util::PluginPattern::workgroup)};
     util::callPreCapturePlugins(context);
 
     using RAJA::util::trigger_updates_before;
@@ -284,6 +286,7 @@ public:
     // but it was never used so no synchronization necessary
     m_storage.clear();
     m_runner.clear();
+    m_num_iterations = 0;
   }
 
   ~WorkPool()
@@ -295,6 +298,7 @@ private:
   storage_type m_storage;
   size_t m_max_num_loops = 0;
   size_t m_max_storage_bytes = 0;
+  size_t m_num_iterations = 0;
 
   workrunner_type m_runner;
 };
@@ -339,11 +343,20 @@ public:
   WorkGroup(WorkGroup&&) = default;
   WorkGroup& operator=(WorkGroup&&) = default;
 
-  inline worksite_type run(resource_type r, Args...);
+  inline worksite_type run(util::KernelName name, resource_type r, Args...);
+
+  worksite_type run(util::KernelName name, Args... args) {
+    auto r = resource_type::get_default();
+    return run(name, r, std::move(args)...);
+  }
+
+  worksite_type run(resource_type r, Args... args) {
+    return run(util::KernelName{}, r, std::move(args)...);
+  }
 
   worksite_type run(Args... args) {
     auto r = resource_type::get_default();
-    return run(r, std::move(args)...);
+    return run(util::KernelName{}, r, std::move(args)...);
   }
 
   void clear()
@@ -352,6 +365,7 @@ public:
     // TODO: synchronize
     m_storage.clear();
     m_runner.clear();
+    m_num_iterations = 0;
   }
 
   ~WorkGroup()
@@ -362,10 +376,13 @@ public:
 private:
   storage_type m_storage;
   workrunner_type m_runner;
+  size_t m_num_iterations;
 
-  WorkGroup(storage_type&& storage, workrunner_type&& runner)
+  WorkGroup(storage_type&& storage, workrunner_type&& runner,
+            size_t num_iterations)
     : m_storage(std::move(storage))
     , m_runner(std::move(runner))
+    , m_num_iterations(num_iterations)
   { }
 };
 
@@ -459,7 +476,10 @@ WorkPool<
   m_max_storage_bytes = std::max(m_storage.storage_size(), m_max_storage_bytes);
 
   // move storage into workgroup
-  return workgroup_type{std::move(m_storage), std::move(m_runner)};
+  size_t num_iterations = m_num_iterations;
+  m_num_iterations = 0;
+  return workgroup_type{std::move(m_storage), std::move(m_runner),
+                        num_iterations};
 }
 
 template <typename EXEC_POLICY_T,
@@ -478,14 +498,16 @@ WorkGroup<
     WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
     INDEX_T,
     xargs<Args...>,
-    ALLOCATOR_T>::run(typename WorkGroup<
+    ALLOCATOR_T>::run(util::KernelName name,
+                      typename WorkGroup<
                           WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
                           INDEX_T,
                           xargs<Args...>,
                           ALLOCATOR_T>::resource_type r,
                       Args... args)
 {
-  util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
+  util::PluginContext context{util::make_context<EXEC_POLICY_T>(
+      util::PluginPattern::workgroup, name, m_num_iterations)};
   util::callPreLaunchPlugins(context);
 
   // move any per run storage into worksite
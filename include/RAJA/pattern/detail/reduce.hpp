@@ -18,17 +18,33 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include <atomic>
+
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/plugins.hpp"
 #include "RAJA/util/types.hpp"
 
-#define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
-  template <typename T>                                       \
-  class Reduce##OP<POL, T>                                    \
-      : public reduce::detail::BaseReduce##OP<T, COMBINER>    \
-  {                                                           \
-  public:                                                     \
-    using Base = reduce::detail::BaseReduce##OP<T, COMBINER>; \
-    using Base::Base;                                         \
+#define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)                       \
+  template <typename T>                                               \
+  class Reduce##OP<POL, T>                                            \
+      : public reduce::detail::BaseReduce##OP<T, COMBINER>            \
+  {                                                                   \
+  public:                                                             \
+    using Base = reduce::detail::BaseReduce##OP<T, COMBINER>;         \
+    using Base::Base;                                                 \
+                                                                      \
+    /*! Get the calculated reduced value */                           \
+    operator T() const { return get(); }                              \
+                                                                      \
+    /*! Get the calculated reduced value */                           \
+    T get() const                                                     \
+    {                                                                 \
+      return reduce::detail::get_with_plugins<POL>(                   \
+          m_plugin_state, [this] { return Base::get(); });            \
+    }                                                                 \
+                                                                      \
+  private:                                                            \
+    reduce::detail::ReducePluginState m_plugin_state;                 \
   };
 
 #define RAJA_DECLARE_INDEX_REDUCER(OP, POL, COMBINER)                    \
@@ -39,6 +55,22 @@
   public:                                                                \
     using Base = reduce::detail::BaseReduce##OP<T, IndexType, COMBINER>; \
     using Base::Base;                                                    \
+                                                                         \
+    /*! Get the calculated reduced index */                              \
+    IndexType getLoc() const { return get().getLoc(); }                  \
+                                                                         \
+    /*! Get the calculated reduced value */                              \
+    operator T() const { return get(); }                                 \
+                                                                         \
+    /*! Get the calculated reduced value and index */                    \
+    typename Base::value_type get() const                                \
+    {                                                                    \
+      return reduce::detail::get_with_plugins<POL>(                      \
+          m_plugin_state, [this] { return Base::get(); });               \
+    }                                                                    \
+                                                                         \
+  private:                                                               \
+    reduce::detail::ReducePluginState m_plugin_state;                    \
   };
 
 #define RAJA_DECLARE_ALL_REDUCERS(POL, COMBINER)       \
@@ -174,6 +206,78 @@ namespace reduce
 namespace detail
 {
 
+/*!
+ * \brief Remembers whether a host reducer was copied into a loop body since
+ *        its result was last read.
+ *
+ * Copies point back at the reducer they were made from, like the
+ * combiners, and mark it when they are made.
+ */
+class ReducePluginState
+{
+public:
+  ReducePluginState() = default;
+
+  ReducePluginState(ReducePluginState const &other)
+      : m_root(other.m_root ? other.m_root : &other)
+  {
+    m_root->m_pending.store(true, std::memory_order_relaxed);
+  }
+
+  ReducePluginState(ReducePluginState &&other)
+      : m_root(other.m_root),
+        m_pending(other.m_pending.load(std::memory_order_relaxed))
+  {
+  }
+
+  ReducePluginState &operator=(ReducePluginState const &) = delete;
+
+  ReducePluginState &operator=(ReducePluginState &&other)
+  {
+    m_root = other.m_root;
+    m_pending.store(other.m_pending.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+    return *this;
+  }
+
+  //! true for the first read after the reducer was copied into a loop body
+  bool take_pending() const
+  {
+    ReducePluginState const *root = m_root ? m_root : this;
+    return root->m_pending.exchange(false, std::memory_order_relaxed);
+  }
+
+private:
+  ReducePluginState const *m_root = nullptr;
+  mutable std::atomic<bool> m_pending{false};
+};
+
+/*!
+ * \brief Read the result of a reducer with policy POL through get_fn.
+ *
+ * The first read after a loop that used the reducer finalizes it and is
+ * bracketed by the plugin launch callbacks; later reads of the same result
+ * do not call the plugins again.
+ */
+template <typename POL, typename GetFn>
+auto get_with_plugins(ReducePluginState const &state, GetFn&& get_fn)
+    -> decltype(get_fn())
+{
+  if (!state.take_pending()) {
+    return get_fn();
+  }
+
+  util::PluginContext context{
+      util::make_context<POL>(util::PluginPattern::reduce)};
+  util::callPreLaunchPlugins(context);
+
+  auto val = get_fn();
+
+  util::callPostLaunchPlugins(context);
+
+  return val;
+}
+
 template <typename T,
           template <typename>
           class Reduce_,
@@ -0,0 +1,208 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Base types used by reducers whose results do not depend on the
+ *          number of threads or the order in which values are combined.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP
+#define RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/util/ExactSum.hpp"
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Per-copy state of a reproducible reducer.
+ *
+ * The values of min, max, and bitwise operations do not depend on the
+ * combining order, so they keep a plain value.
+ */
+template <typename T, typename Reduce, typename Enable = void>
+class ReproducibleAccumulator
+{
+  static_assert(!(std::is_floating_point<T>::value &&
+                  std::is_same<Reduce, RAJA::reduce::sum<T>>::value),
+                "reproducible sums support floating point types up to the "
+                "size of double, not e.g. long double");
+
+  T value;
+
+public:
+  explicit ReproducibleAccumulator(T init_val) : value{init_val} {}
+
+  void add(T const& other) { Reduce{}(value, other); }
+
+  void add(ReproducibleAccumulator const& other)
+  {
+    Reduce{}(value, other.value);
+  }
+
+  T get() const { return value; }
+};
+
+/*!
+ * \brief Floating point sums accumulate exactly and round once in get().
+ *
+ * The exact sum holds doubles, so wider types such as long double are
+ * rejected by the primary template instead of losing their precision.
+ */
+template <typename T>
+class ReproducibleAccumulator<
+    T,
+    RAJA::reduce::sum<T>,
+    typename std::enable_if<std::is_floating_point<T>::value &&
+                            sizeof(T) <= sizeof(double)>::type>
+{
+  RAJA::detail::ExactSum value;
+
+public:
+  explicit ReproducibleAccumulator(T init_val) : value{double(init_val)} {}
+
+  void add(T const& other) { value.add(double(other)); }
+
+  void add(ReproducibleAccumulator const& other) { value.add(other.value); }
+
+  T get() const { return static_cast<T>(value.get()); }
+};
+
+/*!
+ * \brief Orders the locations of equal values in MinLoc and MaxLoc
+ *        reductions; index types without operator< are never ordered.
+ */
+template <typename IndexType, typename Enable = void>
+struct ReproducibleLocLess
+{
+  static bool less(IndexType const&, IndexType const&) { return false; }
+};
+
+template <typename IndexType>
+struct ReproducibleLocLess<
+    IndexType,
+    decltype(void(std::declval<IndexType const&>() <
+                  std::declval<IndexType const&>()))>
+{
+  static bool less(IndexType const& a, IndexType const& b) { return a < b; }
+};
+
+/*!
+ * \brief MinLoc and MaxLoc break ties between equal values by the smallest
+ *        location, which the order of combining would otherwise decide.
+ */
+template <typename T, typename IndexType, bool doing_min, typename Reduce>
+class ReproducibleAccumulator<ValueLoc<T, IndexType, doing_min>, Reduce>
+{
+  using value_type = ValueLoc<T, IndexType, doing_min>;
+
+  value_type value;
+
+public:
+  explicit ReproducibleAccumulator(value_type init_val) : value{init_val} {}
+
+  void add(value_type const& other)
+  {
+    const bool better = doing_min ? other.val < value.val
+                                  : other.val > value.val;
+    if (better ||
+        (other.val == value.val &&
+         ReproducibleLocLess<IndexType>::less(other.loc, value.loc))) {
+      value = other;
+    }
+  }
+
+  void add(ReproducibleAccumulator const& other) { add(other.value); }
+
+  value_type get() const { return value; }
+};
+
+/*!
+ * \brief Base of reproducible reducer combiners; copies accumulate
+ *        separately and Derived merges them into the parent.
+ */
+template <typename T, typename Reduce, typename Derived>
+class BaseReproducibleCombinable
+{
+protected:
+  using accumulator_type = ReproducibleAccumulator<T, Reduce>;
+
+  BaseReproducibleCombinable const *parent = nullptr;
+  T identity;
+  accumulator_type mutable my_data;
+
+public:
+  BaseReproducibleCombinable(T init_val, T identity_ = T())
+      : identity{identity_}, my_data{init_val}
+  {
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    identity = identity_;
+    my_data = accumulator_type{init_val};
+  }
+
+  BaseReproducibleCombinable(BaseReproducibleCombinable const &other)
+      : parent{other.parent ? other.parent : &other},
+        identity{other.identity},
+        my_data{other.identity}
+  {
+  }
+
+  void combine(T const &other) { my_data.add(other); }
+
+  /*!
+   *  \return the calculated reduced value
+   */
+  T get() const { return derived().get_combined(); }
+
+  T get_combined() const { return my_data.get(); }
+
+protected:
+  //! merge this copy into the reducer it was copied from
+  void merge_into_parent() const
+  {
+    if (parent) {
+      parent->my_data.add(my_data);
+    }
+  }
+
+private:
+  // Convenience method for CRTP
+  const Derived &derived() const
+  {
+    return *(static_cast<const Derived *>(this));
+  }
+};
+
+}  // namespace detail
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif
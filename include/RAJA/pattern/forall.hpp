@@ -54,6 +54,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -62,6 +63,7 @@
 
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/policy/MultiPolicy.hpp"
+#include "RAJA/policy/AutoTunePolicy.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
@@ -274,6 +276,7 @@ inline namespace policy_by_value_interface
 template <typename ExecutionPolicy, typename Res, typename IdxSet, typename LoopBody>
 RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                                                      Res r,
+                                                     util::KernelName name,
                                                      IdxSet&& c,
                                                      LoopBody&& loop_body)
 {
@@ -281,7 +284,8 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::PluginPattern::forall, name, c.getLength())};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -291,15 +295,46 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
 
   util::callPreLaunchPlugins(context);
 
+  util::ImbalanceScope imbalance;
+
   RAJA::resources::EventProxy<Res> e = wrap::forall_Icount(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<IdxSet>(c),
       std::move(body));
 
+  imbalance.finish(context);
   util::callPostLaunchPlugins(context);
   return e;
 }
+template <typename ExecutionPolicy, typename Res, typename IdxSet, typename LoopBody>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
+                                                     Res r,
+                                                     IdxSet&& c,
+                                                     LoopBody&& loop_body)
+{
+  return ::RAJA::policy_by_value_interface::forall_Icount(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      util::KernelName{},
+      std::forward<IdxSet>(c),
+      std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
+                                                     util::KernelName name,
+                                                     IdxSet&& c,
+                                                     LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall_Icount(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      name,
+      std::forward<IdxSet>(c),
+      std::forward<LoopBody>(loop_body));
+}
 template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
           typename Res = typename resources::get_resource<ExecutionPolicy>::type >
 RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
@@ -325,13 +360,18 @@ template <typename ExecutionPolicy, typename Res, typename IdxSet, typename Loop
 RAJA_INLINE concepts::enable_if_t<
     resources::EventProxy<Res>,
     type_traits::is_indexset_policy<ExecutionPolicy>>
-forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
+forall(ExecutionPolicy&& p,
+       Res r,
+       util::KernelName name,
+       IdxSet&& c,
+       LoopBody&& loop_body)
 {
   static_assert(type_traits::is_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::PluginPattern::forall, name, c.getLength())};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -341,15 +381,49 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
 
   util::callPreLaunchPlugins(context);
 
+  util::ImbalanceScope imbalance;
+
   resources::EventProxy<Res> e = wrap::forall(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<IdxSet>(c),
       std::move(body));
 
+  imbalance.finish(context);
   util::callPostLaunchPlugins(context);
   return e;
 }
+template <typename ExecutionPolicy, typename Res, typename IdxSet, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_indexset_policy<ExecutionPolicy>>
+forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
+{
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      util::KernelName{},
+      std::forward<IdxSet>(c),
+      std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_indexset_policy<ExecutionPolicy>>
+forall(ExecutionPolicy&& p,
+       util::KernelName name,
+       IdxSet&& c,
+       LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      name,
+      std::forward<IdxSet>(c),
+      std::forward<LoopBody>(loop_body));
+}
 template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
           typename Res = typename resources::get_resource<ExecutionPolicy>::type >
 RAJA_INLINE concepts::enable_if_t<
@@ -409,6 +483,7 @@ RAJA_INLINE concepts::enable_if_t<
     type_traits::is_integral<IndexType>>
 forall_Icount(ExecutionPolicy&& p,
               Res r,
+              util::KernelName name,
               Container&& c,
               IndexType icount,
               LoopBody&& loop_body)
@@ -416,7 +491,11 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using std::begin;
+  using std::end;
+  using std::distance;
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::PluginPattern::forall, name, distance(begin(c), end(c)))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -426,6 +505,8 @@ forall_Icount(ExecutionPolicy&& p,
 
   util::callPreLaunchPlugins(context);
 
+  util::ImbalanceScope imbalance;
+
   resources::EventProxy<Res> e = wrap::forall_Icount(
       r,
       std::forward<ExecutionPolicy>(p),
@@ -433,9 +514,58 @@ forall_Icount(ExecutionPolicy&& p,
       icount,
       std::move(body));
 
+  imbalance.finish(context);
   util::callPostLaunchPlugins(context);
   return e;
 }
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename IndexType,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_range<Container>,
+    type_traits::is_integral<IndexType>>
+forall_Icount(ExecutionPolicy&& p,
+              Res r,
+              Container&& c,
+              IndexType icount,
+              LoopBody&& loop_body)
+{
+  return ::RAJA::policy_by_value_interface::forall_Icount(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      util::KernelName{},
+      std::forward<Container>(c),
+      icount,
+      std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy,
+          typename Container,
+          typename IndexType,
+          typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_range<Container>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_integral<IndexType>>
+forall_Icount(ExecutionPolicy&& p,
+              util::KernelName name,
+              Container&& c,
+              IndexType icount,
+              LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall_Icount(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      name,
+      std::forward<Container>(c),
+      icount,
+      std::forward<LoopBody>(loop_body));
+}
 template <typename ExecutionPolicy,
           typename Container,
           typename IndexType,
@@ -472,13 +602,22 @@ RAJA_INLINE concepts::enable_if_t<
     resources::EventProxy<Res>,
     concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
     concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_auto_tune_policy<ExecutionPolicy>>,
     type_traits::is_range<Container>>
-forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
+forall(ExecutionPolicy&& p,
+       Res r,
+       util::KernelName name,
+       Container&& c,
+       LoopBody&& loop_body)
 {
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using std::begin;
+  using std::end;
+  using std::distance;
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::PluginPattern::forall, name, distance(begin(c), end(c)))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -488,21 +627,62 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
 
   util::callPreLaunchPlugins(context);
 
+  util::ImbalanceScope imbalance;
+
   resources::EventProxy<Res> e =  wrap::forall(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<Container>(c),
       std::move(body));
 
+  imbalance.finish(context);
   util::callPostLaunchPlugins(context);
   return e;
 }
+template <typename ExecutionPolicy, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_auto_tune_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
+{
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      util::KernelName{},
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body));
+}
 template <typename ExecutionPolicy, typename Container, typename LoopBody,
           typename Res = typename resources::get_resource<ExecutionPolicy>::type >
 RAJA_INLINE concepts::enable_if_t<
     resources::EventProxy<Res>,
     concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
     concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_auto_tune_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p,
+       util::KernelName name,
+       Container&& c,
+       LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      name,
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy, typename Container, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_auto_tune_policy<ExecutionPolicy>>,
     type_traits::is_range<Container>>
 forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 {
@@ -517,6 +697,203 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 }  // end inline namespace policy_by_value_interface
 
 
+namespace detail
+{
+
+/// Run candidate Policy of an auto_tune_exec on the caller's resource r,
+/// waiting for it to complete when the launch is timed.
+template <typename Policy, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE void auto_tune_run(std::true_type,
+                               Res& r,
+                               bool wait,
+                               util::KernelName name,
+                               Container&& c,
+                               LoopBody&& loop_body)
+{
+  ::RAJA::policy_by_value_interface::forall(Policy(),
+                                            r,
+                                            name,
+                                            std::forward<Container>(c),
+                                            std::forward<LoopBody>(loop_body));
+  if (wait) {
+    r.wait();
+  }
+}
+
+/// A candidate using another resource type runs on its default resource and
+/// is always waited for, as the event returned to the caller is on r.
+template <typename Policy, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE void auto_tune_run(std::false_type,
+                               Res&,
+                               bool,
+                               util::KernelName name,
+                               Container&& c,
+                               LoopBody&& loop_body)
+{
+  auto r = resources::get_resource<Policy>::type::get_default();
+  ::RAJA::policy_by_value_interface::forall(Policy(),
+                                            r,
+                                            name,
+                                            std::forward<Container>(c),
+                                            std::forward<LoopBody>(loop_body));
+  r.wait();
+}
+
+/// Run candidate number candidate of an auto_tune_exec.
+template <typename Res, typename Container, typename LoopBody>
+RAJA_INLINE void auto_tune_invoke(camp::list<>,
+                                  int,
+                                  Res&,
+                                  bool,
+                                  util::KernelName,
+                                  Container&&,
+                                  LoopBody&&)
+{
+}
+
+template <typename Policy, typename... Rest, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE void auto_tune_invoke(camp::list<Policy, Rest...>,
+                                  int candidate,
+                                  Res& r,
+                                  bool wait,
+                                  util::KernelName name,
+                                  Container&& c,
+                                  LoopBody&& loop_body)
+{
+  if (candidate == 0) {
+    using same_resource =
+        std::is_same<typename resources::get_resource<Policy>::type, Res>;
+    auto_tune_run<Policy>(same_resource{},
+                          r,
+                          wait,
+                          name,
+                          std::forward<Container>(c),
+                          std::forward<LoopBody>(loop_body));
+  } else {
+    auto_tune_invoke(camp::list<Rest...>{},
+                     candidate - 1,
+                     r,
+                     wait,
+                     name,
+                     std::forward<Container>(c),
+                     std::forward<LoopBody>(loop_body));
+  }
+}
+
+}  // namespace detail
+
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with an auto-tuning policy
+ *
+ ******************************************************************************
+ */
+template <typename... Policies, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_range<Container>>
+forall(const auto_tune_exec<Policies...>&,
+       Res r,
+       util::KernelName name,
+       Container&& c,
+       LoopBody&& loop_body)
+{
+  using candidate_list = camp::list<Policies...>;
+
+  if (name.name == nullptr) {
+    detail::auto_tune_invoke(candidate_list{}, 0, r, false, name,
+                             std::forward<Container>(c),
+                             std::forward<LoopBody>(loop_body));
+    return resources::EventProxy<Res>(r);
+  }
+
+  static const char* const candidates[] = {util::type_name<Policies>()...};
+
+  using std::begin;
+  using std::end;
+  using std::distance;
+  auto& tuner = policy::autotune::detail::auto_tuner();
+  const auto choice = tuner.choose(name.name,
+                                   static_cast<std::size_t>(distance(begin(c), end(c))),
+                                   candidates,
+                                   static_cast<int>(sizeof...(Policies)));
+
+  if (!choice.timed) {
+    detail::auto_tune_invoke(candidate_list{}, choice.candidate, r, false, name,
+                             std::forward<Container>(c),
+                             std::forward<LoopBody>(loop_body));
+    return resources::EventProxy<Res>(r);
+  }
+
+  using clock = std::chrono::steady_clock;
+  const clock::time_point start = clock::now();
+  detail::auto_tune_invoke(candidate_list{}, choice.candidate, r, true, name,
+                           std::forward<Container>(c),
+                           std::forward<LoopBody>(loop_body));
+  const double seconds =
+      std::chrono::duration<double>(clock::now() - start).count();
+  tuner.record(choice, seconds, candidates);
+
+  return resources::EventProxy<Res>(r);
+}
+template <typename... Policies, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_range<Container>>
+forall(const auto_tune_exec<Policies...>& p,
+       Res r,
+       Container&& c,
+       LoopBody&& loop_body)
+{
+  return ::RAJA::policy_by_value_interface::forall(
+      p,
+      r,
+      util::KernelName{},
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body));
+}
+template <typename... Policies, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    type_traits::is_range<Container>>
+forall(const auto_tune_exec<Policies...>& p,
+       util::KernelName name,
+       Container&& c,
+       LoopBody&& loop_body)
+{
+  auto r = resources::Host::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      p,
+      r,
+      name,
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body));
+}
+template <typename... Policies, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    type_traits::is_range<Container>>
+forall(const auto_tune_exec<Policies...>& p,
+       Container&& c,
+       LoopBody&& loop_body)
+{
+  auto r = resources::Host::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      p,
+      r,
+      util::KernelName{},
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body));
+}
+
+}  // end inline namespace policy_by_value_interface
+
+
 /*!
  * \brief Conversion from template-based policy to value-based policy for forall
  *
@@ -82,6 +82,33 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE std::size_t segment_tuple_length_impl(Tuple const &t,
+                                                  camp::idx_seq<I...>)
+{
+  const std::size_t lengths[] = {
+      std::size_t(1),
+      static_cast<std::size_t>(camp::get<I>(t).end() -
+                               camp::get<I>(t).begin())...};
+  std::size_t total = 1;
+  for (std::size_t len : lengths) {
+    total *= len;
+  }
+  return total;
+}
+
+/*!
+ * Number of points in the iteration space spanned by a segment tuple.
+ */
+template <class Tuple>
+RAJA_INLINE std::size_t segment_tuple_length(Tuple const &t)
+{
+  return segment_tuple_length_impl(
+      t,
+      camp::make_idx_seq_t<camp::tuple_size<camp::decay<Tuple>>::value>{});
+}
+
 }  // namespace internal
 
 template <class Tuple>
@@ -101,12 +128,14 @@ template <typename PolicyType,
           typename ParamTuple,
           typename Resource,
           typename... Bodies>
-RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &&segments,
+RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(util::KernelName name,
+                                                                  SegmentTuple &&segments,
                                                                   ParamTuple &&params,
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{util::make_context<PolicyType>(
+      util::PluginPattern::kernel, name, internal::segment_tuple_length(segments))};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -143,15 +172,51 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
 
   util::callPreLaunchPlugins(context);
 
+  util::ImbalanceScope imbalance;
+
   // Execute!
   RAJA_FORCEINLINE_RECURSIVE
   internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
 
+  imbalance.finish(context);
   util::callPostLaunchPlugins(context);
 
   return resources::EventProxy<Resource>(resource);
 }
 
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &&segments,
+                                                                  ParamTuple &&params,
+                                                                  Resource resource,
+                                                                  Bodies &&... bodies)
+{
+  return RAJA::kernel_param_resource<PolicyType>(util::KernelName{},
+                                                 std::forward<SegmentTuple>(segments),
+                                                 std::forward<ParamTuple>(params),
+                                                 resource,
+                                                 std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_resource(util::KernelName name,
+                                                            SegmentTuple &&segments,
+                                                            Resource resource,
+                                                            Bodies &&... bodies)
+{
+  return RAJA::kernel_param_resource<PolicyType>(name,
+                                                 std::forward<SegmentTuple>(segments),
+                                                 RAJA::make_tuple(),
+                                                 resource,
+                                                 std::forward<Bodies>(bodies)...);
+}
+
 template <typename PolicyType,
           typename SegmentTuple,
           typename Resource,
@@ -166,6 +231,23 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_resource(SegmentTuple &&segme
                                                  std::forward<Bodies>(bodies)...);
 }
 
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> kernel_param(util::KernelName name,
+                                                                                           SegmentTuple &&segments,
+                                                                                           ParamTuple &&params,
+                                                                                           Bodies &&... bodies)
+{
+  auto res = resources::get_default_resource<PolicyType>();
+  return RAJA::kernel_param_resource<PolicyType>(name,
+                                                 std::forward<SegmentTuple>(segments),
+                                                 std::forward<ParamTuple>(params),
+                                                 res,
+                                                 std::forward<Bodies>(bodies)...);
+}
+
 template <typename PolicyType,
           typename SegmentTuple,
           typename ParamTuple,
@@ -181,6 +263,19 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
                                                  std::forward<Bodies>(bodies)...);
 }
 
+template <typename PolicyType, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> kernel(util::KernelName name,
+                                                                                     SegmentTuple &&segments,
+                                                                                     Bodies &&... bodies)
+{
+  auto res = resources::get_default_resource<PolicyType>();
+  return RAJA::kernel_param_resource<PolicyType>(name,
+                                                 std::forward<SegmentTuple>(segments),
+                                                 RAJA::make_tuple(),
+                                                 res,
+                                                 std::forward<Bodies>(bodies)...);
+}
+
 template <typename PolicyType, typename SegmentTuple, typename... Bodies>
 RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> kernel(SegmentTuple &&segments,
                                                                                      Bodies &&... bodies)
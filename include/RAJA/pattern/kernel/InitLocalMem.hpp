@@ -20,8 +20,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 namespace RAJA
 {
@@ -58,6 +60,26 @@ struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts
 namespace internal
 {
 
+/*!
+ * Local array storage an enclosing statement gave to the current thread,
+ * e.g. the per-thread tile memory of omp_parallel_tile_exec, or nullptr.
+ *
+ * InitLocalMem only reuses storage listed here. Any other pointer already
+ * in a local array comes from an outer scope and may be shared by threads.
+ */
+inline std::vector<void*>*& thread_local_mem()
+{
+  thread_local std::vector<void*>* storage = nullptr;
+  return storage;
+}
+
+inline bool is_thread_local_mem(void const* ptr)
+{
+  std::vector<void*> const* storage = thread_local_mem();
+  return ptr != nullptr && storage != nullptr &&
+         std::find(storage->begin(), storage->end(), ptr) != storage->end();
+}
+
 //Statement executor to initalize RAJA local array
 template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
 struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
@@ -76,6 +98,14 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::value_type;
 
+    // Reuse storage this thread got from an enclosing statement, e.g. the
+    // per-thread tile memory of omp_parallel_tile_exec
+    varType *outer = camp::get<Pos>(data.param_tuple).get_data();
+    if (is_thread_local_mem(outer)) {
+      exec_expanded<others...>(data);
+      return;
+    }
+
     // Initialize memory
 #ifdef RAJA_COMPILER_MSVC
     // MSVC doesn't like taking a pointer to stack allocated data?!?!
@@ -90,7 +120,7 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
     exec_expanded<others...>(data);
 
     // Cleanup and return
-    camp::get<Pos>(data.param_tuple).set_data(nullptr);
+    camp::get<Pos>(data.param_tuple).set_data(outer);
 #ifdef RAJA_COMPILER_MSVC
     delete[] ptr;
 #endif
@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/KernelTuning.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/plugins.hpp"
@@ -134,6 +135,8 @@ public:
   Threads threads;
   Lanes lanes;
   const char *kernel_name{nullptr};
+  util::SourceLocation location{};
+  util::WorkEstimate work{};
 
   RAJA_INLINE
   Grid() = default;
@@ -141,6 +144,10 @@ public:
   Grid(Teams in_teams, Threads in_threads, const char *in_kernel_name = nullptr)
     : teams(in_teams), threads(in_threads), kernel_name(in_kernel_name){};
 
+  Grid(Teams in_teams, Threads in_threads, util::KernelName name)
+    : teams(in_teams), threads(in_threads), kernel_name(name.name),
+      location(name.location), work(name.work){};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -177,14 +184,129 @@ public:
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
+/*!
+ * \brief Host threads tuned for the launches of grid, 0 if not tuned.
+ *
+ * Host launch policies run named kernels with this many threads when an
+ * entry exists for the kernel name, the number of teams and the current
+ * thread count; tune_launch_threads() fills the entries.
+ */
+inline int tuned_launch_threads(Grid const &grid)
+{
+  if (grid.kernel_name == nullptr || util::tuning_database().size() == 0) {
+    return 0;
+  }
+  std::vector<Index_type> threads(1);
+  if (!util::get_tuned_values(
+          util::tuning_key("launch", grid.kernel_name,
+                           {grid.teams.value[0], grid.teams.value[1],
+                            grid.teams.value[2]}),
+          threads)) {
+    return 0;
+  }
+  return static_cast<int>(threads[0]);
+}
+
+/*!
+ * \brief Offline search for the host thread count of kernel name.
+ *
+ * run() must launch the kernel once with a Grid named name and with teams;
+ * each candidate thread count is stored in the table while it is timed, and
+ * the fastest is kept and returned.
+ */
+template <typename Run>
+int tune_launch_threads(const char *name,
+                        Teams teams,
+                        const std::vector<int> &candidates,
+                        Run &&run,
+                        int trials = 3)
+{
+  const std::string key = util::tuning_key(
+      "launch", name, {teams.value[0], teams.value[1], teams.value[2]});
+  std::vector<std::vector<Index_type>> values;
+  for (int threads : candidates) {
+    values.push_back(std::vector<Index_type>{threads});
+  }
+  const std::size_t best = util::tune_parameters(
+      key, values,
+      [&](const std::vector<Index_type> &threads) {
+        util::set_tuned_values(key, threads);
+        run();
+      },
+      trials);
+  return candidates.empty() ? 0 : candidates[best];
+}
+
+namespace detail
+{
+
+template <typename LAUNCH_POLICY>
+util::PluginContext make_launch_context(Grid const &grid)
+{
+  std::size_t num_iterations = 1;
+  for (int i = 0; i < 3; ++i) {
+    num_iterations *= static_cast<std::size_t>(grid.teams.value[i]) *
+                      static_cast<std::size_t>(grid.threads.value[i]);
+  }
+  return util::make_context<LAUNCH_POLICY>(
+      util::PluginPattern::launch,
+      util::KernelName(grid.kernel_name, grid.location, grid.work),
+      num_iterations);
+}
+
+//! Launch body with LAUNCH_POLICY, bracketed by the plugin callbacks
+template <typename LAUNCH_POLICY, typename BODY>
+void launch_with_plugins(Grid const &grid, BODY const &body)
+{
+  util::PluginContext context{make_launch_context<LAUNCH_POLICY>(grid)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto p_body = trigger_updates_before(body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  LaunchExecute<LAUNCH_POLICY>::exec(LaunchContext(grid), p_body);
+
+  util::callPostLaunchPlugins(context);
+}
+
+template <typename LAUNCH_POLICY, typename BODY>
+resources::EventProxy<resources::Resource>
+launch_with_plugins(RAJA::resources::Resource res,
+                    Grid const &grid,
+                    BODY const &body)
+{
+  util::PluginContext context{make_launch_context<LAUNCH_POLICY>(grid)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto p_body = trigger_updates_before(body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<resources::Resource> e =
+      LaunchExecute<LAUNCH_POLICY>::exec(res, LaunchContext(grid), p_body);
+
+  util::callPostLaunchPlugins(context);
+
+  return e;
+}
+
+}  // namespace detail
+
 //Policy based launch
 template <typename LAUNCH_POLICY, typename BODY>
 void launch(Grid const &grid, BODY const &body)
 {
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
-  using launch_t = LaunchExecute<typename LAUNCH_POLICY::host_policy_t>;
-  launch_t::exec(LaunchContext(grid), body);
+  detail::launch_with_plugins<typename LAUNCH_POLICY::host_policy_t>(grid,
+                                                                    body);
 }
 
 
@@ -194,14 +316,12 @@ void launch(ExecPlace place, Grid const &grid, BODY const &body)
 {
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
-      launch_t::exec(LaunchContext(grid), body);
+      detail::launch_with_plugins<typename POLICY_LIST::host_policy_t>(grid, body);
       break;
     }
 #ifdef RAJA_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
-      launch_t::exec(LaunchContext(grid), body);
+      detail::launch_with_plugins<typename POLICY_LIST::device_policy_t>(grid, body);
       break;
     }
 #endif
@@ -242,13 +362,13 @@ launch(RAJA::resources::Resource res, Grid const &grid, BODY const &body)
 
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
-      return launch_t::exec(res, LaunchContext(grid), body); break;
+      return detail::launch_with_plugins<typename POLICY_LIST::host_policy_t>(
+          res, grid, body);
     }
 #ifdef RAJA_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
-      return launch_t::exec(res, LaunchContext(grid), body); break;
+      return detail::launch_with_plugins<typename POLICY_LIST::device_policy_t>(
+          res, grid, body);
     }
 #endif
     default: {
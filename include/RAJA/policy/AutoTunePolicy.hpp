@@ -0,0 +1,252 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file with the auto-tuning policy, which picks the
+ *          fastest of a list of policies for each named kernel at runtime.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AutoTunePolicy_HPP
+#define RAJA_AutoTunePolicy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/TuningDatabase.hpp"
+#include "RAJA/util/concepts.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace autotune
+{
+
+/// auto_tune_exec - Meta-policy for forall choosing the fastest of a
+/// compile-time list of policies at runtime
+///
+/// The first launches of each named kernel run every candidate in turn and
+/// are timed, separately for each power of two range of iteration counts.
+/// Afterwards the candidate with the shortest time is used. Decisions are
+/// stored in util::tuning_database() under the kernel name and the
+/// candidate list, so setting RAJA_TUNING_FILE keeps them across runs.
+/// Kernels without a KernelName always use the first candidate. Candidates
+/// run on the resource passed to forall when they use its type.
+///
+/// \tparam Policies candidate forall policies, at least one
+template <typename... Policies>
+struct auto_tune_exec {
+  static_assert(sizeof...(Policies) > 0,
+                "auto_tune_exec needs at least one candidate policy");
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Tuning state of one kernel and size bucket.
+ */
+struct AutoTuneEntry {
+  std::string name;
+  std::string key;
+  std::vector<double> best_seconds;
+  std::vector<int> trials;
+  std::size_t launches{0};
+  int choice{-1};
+};
+
+/*!
+ * \brief Chooses the candidate for each launch of an auto-tuned kernel and
+ *        collects the timings.
+ *
+ * Every candidate is timed RAJA_AUTOTUNE_TRIALS times, 3 by default, and the
+ * candidate with the best single time wins.
+ */
+class AutoTuner
+{
+public:
+  struct Choice {
+    AutoTuneEntry* entry;
+    int candidate;
+
+    //! true while tuning, the launch has to be timed and recorded
+    bool timed;
+  };
+
+  AutoTuner()
+  {
+    const char* trials = std::getenv("RAJA_AUTOTUNE_TRIALS");
+    const long value = trials ? std::atol(trials) : 0;
+    m_trials = value > 0 ? static_cast<int>(value) : 3;
+  }
+
+  AutoTuner(const AutoTuner&) = delete;
+  AutoTuner& operator=(const AutoTuner&) = delete;
+
+  int trials() const { return m_trials; }
+
+  //! power of two range of num_iterations, tuned separately
+  static int size_bucket(std::size_t num_iterations)
+  {
+    int bucket = 0;
+    while (num_iterations > 1) {
+      num_iterations >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  //! candidates are part of the key, so a changed list is tuned again
+  static std::string database_key(const char* name,
+                                  int bucket,
+                                  const char* const* candidates,
+                                  int num_candidates)
+  {
+    std::string key =
+        std::string("autotune\t") + name + '\t' + std::to_string(bucket) + '\t';
+    for (int c = 0; c < num_candidates; ++c) {
+      if (c > 0) key += " | ";
+      key += candidates[c];
+    }
+    return key;
+  }
+
+  //! candidate for the next launch of kernel name with num_iterations
+  Choice choose(const char* name,
+                std::size_t num_iterations,
+                const char* const* candidates,
+                int num_candidates)
+  {
+    const int bucket = size_bucket(num_iterations);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // names are usually literals and each candidate list is a static array,
+    // look up by address before building a key
+    AutoTuneEntry*& cached =
+        m_by_address[std::make_tuple(name, candidates, bucket)];
+    if (cached == nullptr || cached->name != name) {
+      cached = &find_entry(name, bucket, candidates, num_candidates);
+    }
+    AutoTuneEntry& entry = *cached;
+
+    if (entry.choice >= 0) {
+      return Choice{&entry, entry.choice, false};
+    }
+    const int candidate = static_cast<int>(
+        entry.launches++ % static_cast<std::size_t>(num_candidates));
+    return Choice{&entry, candidate, true};
+  }
+
+  //! record the time of a timed launch, locking in the choice when done
+  void record(const Choice& choice,
+              double seconds,
+              const char* const* candidates)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    AutoTuneEntry& entry = *choice.entry;
+    if (entry.choice >= 0 ||
+        choice.candidate >= static_cast<int>(entry.trials.size())) {
+      return;
+    }
+
+    double& best = entry.best_seconds[choice.candidate];
+    if (entry.trials[choice.candidate] == 0 || seconds < best) {
+      best = seconds;
+    }
+    ++entry.trials[choice.candidate];
+
+    int fastest = 0;
+    for (int c = 0; c < static_cast<int>(entry.trials.size()); ++c) {
+      if (entry.trials[c] < m_trials) return;
+      if (entry.best_seconds[c] < entry.best_seconds[fastest]) fastest = c;
+    }
+    entry.choice = fastest;
+    util::tuning_database().set(entry.key, candidates[fastest]);
+  }
+
+private:
+  AutoTuneEntry& find_entry(const char* name,
+                            int bucket,
+                            const char* const* candidates,
+                            int num_candidates)
+  {
+    const std::string key =
+        database_key(name, bucket, candidates, num_candidates);
+    AutoTuneEntry& entry = m_entries[key];
+    if (static_cast<int>(entry.trials.size()) == num_candidates) {
+      return entry;
+    }
+
+    entry.name = name;
+    entry.key = key;
+    entry.best_seconds.assign(num_candidates, 0.0);
+    entry.trials.assign(num_candidates, 0);
+    entry.launches = 0;
+    entry.choice = -1;
+
+    std::string stored;
+    if (util::tuning_database().get(key, stored)) {
+      for (int c = 0; c < num_candidates; ++c) {
+        if (stored == candidates[c]) {
+          entry.choice = c;
+        }
+      }
+    }
+    return entry;
+  }
+
+  int m_trials{3};
+  std::mutex m_mutex;
+  std::map<std::string, AutoTuneEntry> m_entries;
+  std::map<std::tuple<const char*, const char* const*, int>, AutoTuneEntry*>
+      m_by_address;
+};
+
+inline AutoTuner& auto_tuner()
+{
+  static AutoTuner tuner;
+  return tuner;
+}
+
+}  // end namespace detail
+
+}  // end namespace autotune
+}  // end namespace policy
+
+using policy::autotune::auto_tune_exec;
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_auto_tune_policy
+    : ::RAJA::type_traits::SpecializationOf<RAJA::auto_tune_exec,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // end namespace RAJA
+
+#endif
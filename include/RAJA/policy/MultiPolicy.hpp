@@ -173,7 +173,8 @@ struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
   {
     if (offset == size - index - 1) {
 
-      util::PluginContext context{util::make_context<Policy>()};
+      util::PluginContext context{util::make_context<Policy>(
+          util::PluginPattern::forall)};
       util::callPreCapturePlugins(context);
 
       using RAJA::util::trigger_updates_before;
@@ -204,7 +205,8 @@ struct policy_invoker<0, size, Policy, rest...> {
   {
     if (offset == size - 1) {
 
-      util::PluginContext context{util::make_context<Policy>()};
+      util::PluginContext context{util::make_context<Policy>(
+          util::PluginPattern::forall)};
       util::callPreCapturePlugins(context);
 
       using RAJA::util::trigger_updates_before;
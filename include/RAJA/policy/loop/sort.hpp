@@ -72,6 +72,21 @@ struct StableSorter
   }
 };
 
+/*!
+    \brief Functional that runs the blocks of a radix sort in order
+*/
+struct LoopForEachBlock
+{
+  template < typename diff_type, typename Func >
+  RAJA_INLINE
+  void operator()(diff_type num_blocks, Func&& func) const
+  {
+    for (diff_type block = 0; block < num_blocks; ++block) {
+      func(block);
+    }
+  }
+};
+
 } // namespace detail
 
 /*!
@@ -79,7 +94,8 @@ struct StableSorter
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable<Iter, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -97,7 +113,8 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable<Iter, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -115,7 +132,8 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -137,7 +155,8 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -154,6 +173,86 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort given range of arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable<Iter, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::radix_sort(detail::LoopForEachBlock{}, 1, begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable<Iter, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::radix_sort(detail::LoopForEachBlock{}, 1, begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::radix_sort_pairs(detail::LoopForEachBlock{}, 1,
+                                 keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::radix_sort_pairs(detail::LoopForEachBlock{}, 1,
+                                 keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -20,9 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <iterator>
+
+#include "RAJA/internal/RAJAVec.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
 
 
 namespace RAJA
@@ -75,6 +81,174 @@ struct WorkRunner<
         Args...>
 { };
 
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * in chunks of iterations on the host
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpChunkLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpChunkLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end,
+                              Args... args) const
+  {
+    // chunks of a loop run on several threads, privatize the body as the
+    // omp forall policies do
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(m_body);
+    auto& body = privatizer.get_priv();
+
+    const auto begin = m_segment.begin();
+    const auto end   = m_segment.end();
+    const index_type len(end - begin);
+    if (i_end > len) { i_end = len; }
+    for ( index_type i = i_begin; i < i_end; ++i ) {
+      body(begin[i], std::forward<Args>(args)...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order in a single omp parallel
+ * region, with each loop split into chunks of CHUNK_SIZE iterations and
+ * the chunks of all loops scheduled dynamically across threads
+ */
+template <int CHUNK_SIZE,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_flatten_chunk_dynamic<CHUNK_SIZE>,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = RAJA::policy::omp::unordered_omp_flatten_chunk_dynamic<CHUNK_SIZE>;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  using vtable_type = Vtable<void, index_type, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_chunk_offsets(std::move(o.m_chunk_offsets))
+    , m_total_chunks(o.m_total_chunks)
+  {
+    o.m_total_chunks = 0;
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_chunk_offsets = std::move(o.m_chunk_offsets);
+    m_total_chunks = o.m_total_chunks;
+
+    o.m_total_chunks = 0;
+    return *this;
+  }
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldOmpChunkLoop<ITERABLE, LOOP_BODY,
+                                 index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host in a loop
+  using vtable_exec_policy = RAJA::loop_work;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using Iterator  = camp::decay<decltype(std::begin(iter))>;
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    Iterator begin = std::begin(iter);
+    Iterator end = std::end(iter);
+    IndexType len = std::distance(begin, end);
+
+    // Only store loops that have something to iterate over
+    if (len > 0) {
+
+      // record the first global chunk of this loop
+      m_chunk_offsets.push_back(m_total_chunks);
+      m_total_chunks += (static_cast<index_type>(len) + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    const index_type num_chunks = m_total_chunks;
+
+    // Only open a parallel region if we have something to iterate over
+    if (num_chunks > 0) {
+
+      auto storage_begin = storage.begin();
+      const index_type* offsets_begin = m_chunk_offsets.data();
+      const index_type* offsets_end = offsets_begin + m_chunk_offsets.size();
+
+      #pragma omp parallel for schedule(dynamic, 1)
+      for (index_type c = 0; c < num_chunks; ++c) {
+
+        // find the loop that owns global chunk c
+        const index_type* loop_offset =
+            std::upper_bound(offsets_begin, offsets_end, c) - 1;
+        const index_type i_loop = loop_offset - offsets_begin;
+        const index_type i_begin = (c - *loop_offset) * CHUNK_SIZE;
+
+        value_type::call(&storage_begin[i_loop],
+                         i_begin, i_begin + CHUNK_SIZE, args...);
+      }
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_chunk_offsets.clear();
+    m_total_chunks = 0;
+  }
+
+private:
+  RAJA::RAJAVec<index_type> m_chunk_offsets;
+  index_type m_total_chunks = 0;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -25,8 +25,12 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <omp.h>
 
@@ -43,6 +47,10 @@
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
+#if defined(RAJA_ENABLE_OPENMP_IMBALANCE)
+#include "RAJA/util/ImbalanceRecorder.hpp"
+#endif
+
 
 namespace RAJA
 {
@@ -51,6 +59,78 @@ namespace policy
 {
 namespace omp
 {
+
+#if defined(RAJA_ENABLE_OPENMP_IMBALANCE)
+
+namespace internal
+{
+
+  //
+  // A measured loop runs without a barrier at its end so each thread's time
+  // stops when its share is done; the enclosing parallel region provides the
+  // barrier.
+  //
+  template <typename InnerPolicy>
+  struct measured_policy {
+    using type = InnerPolicy;
+  };
+
+  template <typename Schedule>
+  struct measured_policy<omp_for_schedule_exec<Schedule>> {
+    using type = omp_for_nowait_schedule_exec<Schedule>;
+  };
+
+  template <typename Func>
+  struct counted_body {
+    Func& body;
+    std::size_t& iterations;
+
+    template <typename... Args>
+    RAJA_INLINE void operator()(Args&&... args) const
+    {
+      ++iterations;
+      body(std::forward<Args>(args)...);
+    }
+  };
+
+  ///
+  /// Run a parallel loop recording each thread's busy time and iterations.
+  ///
+  template <typename Iterable, typename Func, typename InnerPolicy>
+  RAJA_INLINE void forall_impl_measured(resources::Host host_res,
+                                        ::RAJA::util::detail::ImbalanceRecorder& recorder,
+                                        const InnerPolicy&,
+                                        Iterable&& iter,
+                                        Func&& loop_body)
+  {
+    using clock = std::chrono::steady_clock;
+
+    // loops nested in the region are part of this measurement
+    ::RAJA::util::detail::current_imbalance_recorder() = nullptr;
+    recorder.reserve(omp_get_max_threads());
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      using priv_t = typename std::remove_reference<decltype(body.get_priv())>::type;
+
+      std::size_t iterations = 0;
+      counted_body<priv_t> counted{body.get_priv(), iterations};
+
+      const clock::time_point start = clock::now();
+      forall_impl(host_res, typename measured_policy<InnerPolicy>::type{}, iter, counted);
+      const clock::time_point stop = clock::now();
+
+      recorder.add(omp_get_thread_num(), start, stop, iterations);
+    });
+
+    ::RAJA::util::detail::current_imbalance_recorder() = &recorder;
+  }
+
+} // end namespace internal
+
+#endif
+
 ///
 /// OpenMP parallel policy implementation
 ///
@@ -60,6 +140,13 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
                                                     Iterable&& iter,
                                                     Func&& loop_body)
 {
+#if defined(RAJA_ENABLE_OPENMP_IMBALANCE)
+  if (auto* recorder = ::RAJA::util::detail::current_imbalance_recorder()) {
+    internal::forall_impl_measured(host_res, *recorder, InnerPolicy{}, iter, loop_body);
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+#endif
+
   RAJA::region<RAJA::omp_parallel_region>([&]() {
     using RAJA::internal::thread_privatize;
     auto body = thread_privatize(loop_body);
@@ -270,6 +357,91 @@ namespace internal
     }
   }
 
+  //
+  // The following nowait variants are not exposed as policies, see
+  // omp_for_nowait_static_exec; they are used where the enclosing parallel
+  // region ends right after the loop.
+  //
+
+  //
+  // omp for schedule(dynamic) nowait
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Dynamic<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(dynamic) nowait
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(dynamic, ChunkSize) nowait
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Dynamic<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(dynamic, ChunkSize) nowait
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(guided) nowait
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Guided<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(guided) nowait
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(guided, ChunkSize) nowait
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Guided<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(guided, ChunkSize) nowait
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(runtime) nowait
+  //
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Runtime&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(runtime) nowait
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
   #if !defined(RAJA_COMPILER_MSVC)
   // dynamic & guided
   template <typename Policy, typename Iterable, typename Func>
@@ -318,6 +490,158 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
+///
+/// Execute a single index set segment after all of its dependencies in the
+/// index set dependency graph are satisfied. Afterwards, the node is reset
+/// so the graph may be reused and each forward-dependent segment is notified.
+///
+template <typename WaitPolicy, typename... SegmentTypes, typename Func>
+RAJA_INLINE void execute_taskgraph_segment(
+    WaitPolicy wait_pol,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    int segid,
+    Func&& seg_body)
+{
+  DepGraphNode* task = iset.getDepGraphNode(segid);
+
+  task->wait(wait_pol);
+
+  seg_body(segid);
+
+  task->reset();
+
+  for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+    DepGraphNode* dep = iset.getDepGraphNode(task->depTaskNum(ii));
+    dep->satisfyOne();
+  }
+}
+
+///
+/// Execute a chain of index set segments without waiting.
+///
+/// A segment with no incoming dependencies is run by the thread it is
+/// scheduled on; every other segment is run by the predecessor that
+/// releases it. The first released successor runs on the current thread,
+/// any other released successors are deferred as OpenMP tasks, which are
+/// completed by idle threads at the end of the enclosing worksharing loop.
+///
+template <typename... SegmentTypes, typename Func, typename PrivFunc>
+RAJA_INLINE void execute_taskgraph_segment(
+    dep_graph::release_inline,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    int segid,
+    PrivFunc&& seg_body,
+    Func const& loop_body)
+{
+  while (segid >= 0) {
+    DepGraphNode* task = iset.getDepGraphNode(segid);
+
+    seg_body(segid);
+
+    task->reset();
+
+    int next = -1;
+    for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+      const int dep_seg = task->depTaskNum(ii);
+      if (iset.getDepGraphNode(dep_seg)->satisfyOne()) {
+        if (next < 0) {
+          next = dep_seg;
+        } else {
+          auto iset_ptr = &iset;
+          auto body_ptr = &loop_body;
+          #pragma omp task firstprivate(iset_ptr, body_ptr, dep_seg)
+          {
+            using RAJA::internal::thread_privatize;
+            auto body = thread_privatize(*body_ptr);
+            execute_taskgraph_segment(dep_graph::release_inline{},
+                                      *iset_ptr,
+                                      dep_seg,
+                                      body.get_priv(),
+                                      *body_ptr);
+          }
+        }
+      }
+    }
+
+    segid = next;
+  }
+}
+
+///
+/// Segment dispatch for waiting strategies; loop_body only needed when
+/// released successors run inline.
+///
+template <typename WaitPolicy, typename... SegmentTypes, typename Func,
+          typename PrivFunc>
+RAJA_INLINE void execute_scheduled_taskgraph_segment(
+    WaitPolicy wait_pol,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    int segid,
+    PrivFunc&& seg_body,
+    Func const&)
+{
+  execute_taskgraph_segment(wait_pol, iset, segid, seg_body);
+}
+
+template <typename... SegmentTypes, typename Func, typename PrivFunc>
+RAJA_INLINE void execute_scheduled_taskgraph_segment(
+    dep_graph::release_inline,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    int segid,
+    PrivFunc&& seg_body,
+    Func const& loop_body)
+{
+  // only segments without incoming dependencies are started here
+  if (iset.getDepGraphNode(segid)->semaphoreReloadValue() == 0) {
+    execute_taskgraph_segment(
+        dep_graph::release_inline{}, iset, segid, seg_body, loop_body);
+  }
+}
+
+template <typename... SegmentTypes>
+RAJA_INLINE void check_taskgraph(const TypedIndexSet<SegmentTypes...>& iset)
+{
+  if (!iset.dependencyGraphSet()) {
+    std::cerr << "\n RAJA IndexSet dependency graph not set , "
+              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+  }
+}
+
+//! every segment must be in exactly one interval, or it is never run
+template <typename... SegmentTypes>
+RAJA_INLINE void check_taskgraph_intervals(
+    const TypedIndexSet<SegmentTypes...>& iset)
+{
+  const std::size_t num_intervals = iset.getNumSegmentIntervals();
+  std::vector<std::pair<int, int>> intervals(num_intervals);
+  for (std::size_t i = 0; i < num_intervals; ++i) {
+    intervals[i] = std::make_pair(iset.getSegmentIntervalBegin(i),
+                                  iset.getSegmentIntervalEnd(i));
+  }
+  std::sort(intervals.begin(), intervals.end());
+
+  int covered = 0;
+  for (const auto& interval : intervals) {
+    if (interval.first != covered || interval.second < interval.first) break;
+    covered = interval.second;
+  }
+
+  if (num_intervals == 0 ||
+      covered != static_cast<int>(iset.getNumSegments()) ||
+      intervals.back().second != covered) {
+    std::cerr << "\n RAJA IndexSet segment intervals do not cover the "
+              << "segments, FILE: " << __FILE__ << " line: " << __LINE__
+              << std::endl;
+    RAJA_ABORT_OR_THROW("IndexSet segment intervals");
+  }
+}
+
+}  // end namespace internal
+
 /*!
  ******************************************************************************
  *
@@ -328,57 +652,102 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
  *         This method assumes that a task dependency graph has been
  *         properly set up for each segment in the index set.
  *
+ *         Segments are assigned to threads with schedule(static, 1), so
+ *         each thread executes its segments in increasing segment order.
+ *         The graph is deadlock-free if every segment only depends on
+ *         segments with a lower id.
+ *
+ *         With the dep_graph::release_inline wait policy no thread waits;
+ *         a segment is run by the predecessor that releases it, so every
+ *         segment must be released at most once per traversal.
+ *
  ******************************************************************************
  */
+template <typename WaitPolicy, typename... SegmentTypes, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host host_res,
+    const omp_taskgraph_wait_segit<WaitPolicy>&,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    Func&& loop_body)
+{
+  internal::check_taskgraph(iset);
 
-/*
- * TODO: Fix this!!!
- */
+  const int num_seg = iset.getNumSegments();
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
-{
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
-  }
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+    #pragma omp for schedule(static, 1)
+    for (int isi = 0; isi < num_seg; ++isi) {
+      internal::execute_scheduled_taskgraph_segment(
+          WaitPolicy{}, iset, isi, body.get_priv(), loop_body);
+    }
+  });
 
-  int num_seg = ncis.getNumSegments();
+  return resources::EventProxy<resources::Host>(host_res);
+}
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using an omp parallel region and
+ *         segment dependency graph. Each thread executes the contiguous
+ *         interval of segments identified by its thread number (see
+ *         TypedIndexSet::setSegmentInterval) in order.
+ *
+ *         This method assumes that a task dependency graph has been
+ *         properly set up for each segment in the index set. There must be
+ *         exactly one interval per thread of the parallel region, and the
+ *         intervals must cover all segments without gaps or overlap;
+ *         otherwise segments would never run and their dependents would
+ *         wait forever, so this aborts or throws instead.
+ *
+ ******************************************************************************
+ */
+template <typename WaitPolicy, typename... SegmentTypes, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host host_res,
+    const omp_taskgraph_interval_wait_segit<WaitPolicy>&,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    Func&& loop_body)
+{
+  internal::check_taskgraph(iset);
+  internal::check_taskgraph_intervals(iset);
 
-    task->wait();
+  const int num_intervals = iset.getNumSegmentIntervals();
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+  // the team size is only known inside the region, and exceptions must not
+  // leave it, so a mismatch is reported after the region ends
+  int num_threads = num_intervals;
 
-    task->reset();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    #pragma omp single
+    num_threads = omp_get_num_threads();
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
+    if (num_threads != num_intervals) return;
+
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+
+    const int tid = omp_get_thread_num();
+    const int begin = iset.getSegmentIntervalBegin(tid);
+    const int end = iset.getSegmentIntervalEnd(tid);
+    for (int isi = begin; isi < end; ++isi) {
+      internal::execute_scheduled_taskgraph_segment(
+        WaitPolicy{}, iset, isi, body.get_priv(), loop_body);
     }
+  });
 
-  }  // iterate over segments of index set
+  if (num_threads != num_intervals) {
+    std::cerr << "\n RAJA IndexSet has " << num_intervals
+              << " segment intervals for " << num_threads << " threads, "
+              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+    RAJA_ABORT_OR_THROW("IndexSet segment intervals");
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
-*/
 
 }  // namespace omp
 
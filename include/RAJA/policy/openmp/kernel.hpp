@@ -20,6 +20,10 @@
 #define RAJA_policy_openmp_kernel_HPP
 
 #include "RAJA/policy/openmp/kernel/Collapse.hpp"
+#include "RAJA/policy/openmp/kernel/Hyperplane.hpp"
 #include "RAJA/policy/openmp/kernel/OmpSyncThreads.hpp"
+#include "RAJA/policy/openmp/kernel/Reduce.hpp"
+#include "RAJA/policy/openmp/kernel/Region.hpp"
+#include "RAJA/policy/openmp/kernel/Tile.hpp"
 
 #endif  // closing endif for header file include guard
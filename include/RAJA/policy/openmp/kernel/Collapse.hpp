@@ -129,7 +129,106 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 };
 
 
+/////////
+// Collapsing any number of loops
+/////////
+
+template <typename Types, typename Data, camp::idx_t... Args>
+struct CollapseSegmentTypes {
+  using type = Types;
+};
+
+template <typename Types, typename Data, camp::idx_t Arg0, camp::idx_t... Args>
+struct CollapseSegmentTypes<Types, Data, Arg0, Args...>
+    : CollapseSegmentTypes<setSegmentTypeFromData<Types, Arg0, Data>,
+                           Data,
+                           Args...> {
+};
+
+/*!
+ * Loops of any depth are linearised into one iteration space for the omp
+ * for, with the first argument outermost. Each thread only divides to
+ * recover the loop indices at the start of a chunk and then steps them like
+ * an odometer, so no division is done per iteration.
+ */
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
+                                             ArgList<Args...>,
+                                             EnclosedStmts...>, Types> {
+
+  static constexpr camp::idx_t num_args = sizeof...(Args);
+  static_assert(num_args > 0, "Collapse needs at least one argument");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const camp::idx_t lengths[num_args] = {static_cast<camp::idx_t>(
+        RAJA::stripIndexType(segment_length<Args>(data)))...};
+
+    camp::idx_t total = 1;
+    for (camp::idx_t d = 0; d < num_args; ++d) {
+      total *= lengths[d] > 0 ? lengths[d] : 0;
+    }
+    if (total == 0) return;
+
+    // Set the argument types for this loop
+    using NewTypes = typename CollapseSegmentTypes<Types, Data, Args...>::type;
 
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+      camp::idx_t index[num_args];
+      camp::idx_t next = -1;
+
+#pragma omp for
+      for (camp::idx_t flat = 0; flat < total; ++flat) {
+        if (flat == next) {
+          step(index, lengths);
+        } else {
+          decode(flat, index, lengths);
+        }
+        next = flat + 1;
+
+        assign_offsets(private_data, index, camp::make_idx_seq_t<num_args>{});
+        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(private_data);
+      }
+    }
+  }
+
+private:
+  static RAJA_INLINE void decode(camp::idx_t flat,
+                                 camp::idx_t (&index)[num_args],
+                                 const camp::idx_t (&lengths)[num_args])
+  {
+    for (camp::idx_t d = num_args - 1; d > 0; --d) {
+      index[d] = flat % lengths[d];
+      flat /= lengths[d];
+    }
+    index[0] = flat;
+  }
+
+  static RAJA_INLINE void step(camp::idx_t (&index)[num_args],
+                               const camp::idx_t (&lengths)[num_args])
+  {
+    for (camp::idx_t d = num_args - 1; d > 0; --d) {
+      if (++index[d] < lengths[d]) return;
+      index[d] = 0;
+    }
+    ++index[0];
+  }
+
+  template <typename Data, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         const camp::idx_t (&index)[num_args],
+                                         camp::idx_seq<Dims...>)
+  {
+    camp::sink((data.template assign_offset<Args>(
+                    segment_diff_type<Args, Data>(index[Dims])),
+                0)...);
+  }
+};
 
 
 }  // namespace internal
@@ -0,0 +1,387 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP hyperplane executors of
+ *          kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_hyperplane_HPP
+#define RAJA_policy_openmp_kernel_hyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/kernel/Collapse.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Execution policy for the points of each hyperplane of statement::Hyperplane.
+ *
+ * All hyperplanes are swept inside one OpenMP parallel region. The points of
+ * a hyperplane are enumerated from its exact bounds, so no iterations outside
+ * the index space are masked out, and they are shared among the threads by
+ * an omp for over the first index of the ArgList. The barrier ending each
+ * omp for orders the hyperplanes; HpExecPolicy is not used.
+ */
+struct omp_hyperplane_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+};
+
+/*!
+ * Blocked wavefront execution policy for statement::Hyperplane.
+ *
+ * The index space is cut into tiles of TileSize points along every index.
+ * Tiles are handed out in hyperplane order by an omp for nowait and a thread
+ * starts a tile as soon as the tiles just below it along each index are
+ * done, instead of waiting at a barrier for the whole previous hyperplane.
+ * The points of a tile are executed in lexicographic order, so each point
+ * may only depend on points that have no larger index along any argument,
+ * as in the usual sweeps and stencil recurrences. HpExecPolicy is not used.
+ */
+template <camp::idx_t TileSize>
+struct omp_hyperplane_tile_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+  static_assert(TileSize > 0, "omp_hyperplane_tile_exec needs a positive tile size");
+  static constexpr camp::idx_t tile_size = TileSize;
+};
+
+namespace internal
+{
+
+/*!
+ * Index space of a hyperplane statement, with the hyperplane argument as
+ * dimension 0 followed by the arguments of the ArgList.
+ */
+template <camp::idx_t HpArgumentId, camp::idx_t... Args>
+struct OmpHyperplaneSpace {
+
+  static constexpr camp::idx_t num_dims = 1 + sizeof...(Args);
+  static_assert(sizeof...(Args) > 0, "Hyperplane needs at least one argument in its ArgList");
+
+  camp::idx_t lengths[num_dims];
+
+  template <typename Data>
+  explicit OmpHyperplaneSpace(Data& data)
+      : lengths{static_cast<camp::idx_t>(
+            RAJA::stripIndexType(segment_length<HpArgumentId>(data))),
+                static_cast<camp::idx_t>(
+                    RAJA::stripIndexType(segment_length<Args>(data)))...}
+  {
+  }
+
+  bool empty() const
+  {
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      if (lengths[d] <= 0) return true;
+    }
+    return false;
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         const camp::idx_t (&index)[num_dims])
+  {
+    data.template assign_offset<HpArgumentId>(
+        segment_diff_type<HpArgumentId, Data>(index[0]));
+    assign_arg_offsets(data,
+                       index,
+                       camp::make_idx_seq_t<sizeof...(Args)>{});
+  }
+
+private:
+  template <typename Data, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_arg_offsets(Data& data,
+                                             const camp::idx_t (&index)[num_dims],
+                                             camp::idx_seq<Dims...>)
+  {
+    camp::sink((data.template assign_offset<Args>(
+                    segment_diff_type<Args, Data>(index[Dims + 1])),
+                0)...);
+  }
+};
+
+
+/*!
+ * Hyperplane executor for omp_hyperplane_exec
+ *
+ * With lengths L0, L1, ... the hyperplanes are h = 0 ... sum(Li - 1). For a
+ * remainder r of h still to be split among i0 and the indices from d on,
+ *
+ *   max(0, r - (L0 - 1) - sum_{j > d}(Lj - 1)) <= id <= min(Ld - 1, r)
+ *
+ * and i0 is what is left once all other indices are chosen.
+ */
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Hyperplane<HpArgumentId,
+                                               HpExecPolicy,
+                                               ArgList<Args...>,
+                                               omp_hyperplane_exec,
+                                               EnclosedStmts...>, Types> {
+
+  using space_t = OmpHyperplaneSpace<HpArgumentId, Args...>;
+  static constexpr camp::idx_t num_dims = space_t::num_dims;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data& data)
+  {
+    const space_t space(data);
+    if (space.empty()) return;
+
+    // rest[d] is the largest sum of the indices after d
+    camp::idx_t rest[num_dims];
+    rest[0] = 0;
+    rest[num_dims - 1] = 0;
+    for (camp::idx_t d = num_dims - 1; d > 1; --d) {
+      rest[d - 1] = rest[d] + space.lengths[d] - 1;
+    }
+
+    camp::idx_t num_planes = 1;
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      num_planes += space.lengths[d] - 1;
+    }
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename CollapseSegmentTypes<Types, Data, HpArgumentId, Args...>::type;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+      camp::idx_t index[num_dims];
+
+      for (camp::idx_t h = 0; h < num_planes; ++h) {
+        const camp::idx_t first = lower(space, rest, 1, h);
+        const camp::idx_t last = upper(space, 1, h);
+
+#pragma omp for
+        for (camp::idx_t i = first; i <= last; ++i) {
+          index[1] = i;
+          visit<NewTypes>(private_data, space, rest, index, 2, h - i);
+        }
+      }
+    }
+  }
+
+private:
+  static RAJA_INLINE camp::idx_t lower(const space_t& space,
+                                       const camp::idx_t (&rest)[num_dims],
+                                       camp::idx_t d,
+                                       camp::idx_t r)
+  {
+    return std::max<camp::idx_t>(0, r - (space.lengths[0] - 1) - rest[d]);
+  }
+
+  static RAJA_INLINE camp::idx_t upper(const space_t& space,
+                                       camp::idx_t d,
+                                       camp::idx_t r)
+  {
+    return std::min<camp::idx_t>(space.lengths[d] - 1, r);
+  }
+
+  template <typename NewTypes, typename Data>
+  static RAJA_INLINE void visit(Data& data,
+                                const space_t& space,
+                                const camp::idx_t (&rest)[num_dims],
+                                camp::idx_t (&index)[num_dims],
+                                camp::idx_t d,
+                                camp::idx_t r)
+  {
+    if (d == num_dims) {
+      index[0] = r;
+      space_t::assign_offsets(data, index);
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+      return;
+    }
+
+    const camp::idx_t last = upper(space, d, r);
+    for (camp::idx_t i = lower(space, rest, d, r); i <= last; ++i) {
+      index[d] = i;
+      visit<NewTypes>(data, space, rest, index, d + 1, r - i);
+    }
+  }
+};
+
+
+/*!
+ * Hyperplane executor for omp_hyperplane_tile_exec
+ *
+ * Tiles are numbered row-major with the hyperplane argument outermost and
+ * are handed out by a dynamic schedule sorted by the hyperplane of the tile.
+ * A tile only waits for tiles earlier in that order, and the earliest
+ * unfinished tile has always been handed out and has nothing left to wait
+ * for, so the threads can not deadlock.
+ */
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          camp::idx_t TileSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Hyperplane<HpArgumentId,
+                                               HpExecPolicy,
+                                               ArgList<Args...>,
+                                               omp_hyperplane_tile_exec<TileSize>,
+                                               EnclosedStmts...>, Types> {
+
+  using space_t = OmpHyperplaneSpace<HpArgumentId, Args...>;
+  static constexpr camp::idx_t num_dims = space_t::num_dims;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data& data)
+  {
+    const space_t space(data);
+    if (space.empty()) return;
+
+    camp::idx_t tiles[num_dims];
+    camp::idx_t num_tiles = 1;
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      tiles[d] = (space.lengths[d] + TileSize - 1) / TileSize;
+      num_tiles *= tiles[d];
+    }
+
+    // tile hyperplane of every tile, and the order tiles are handed out in
+    std::vector<camp::idx_t> planes(num_tiles);
+    std::vector<camp::idx_t> order(num_tiles);
+    for (camp::idx_t t = 0; t < num_tiles; ++t) {
+      camp::idx_t tile[num_dims];
+      decode(t, tiles, tile);
+      planes[t] = 0;
+      for (camp::idx_t d = 0; d < num_dims; ++d) {
+        planes[t] += tile[d];
+      }
+      order[t] = t;
+    }
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](camp::idx_t a, camp::idx_t b) {
+                       return planes[a] < planes[b];
+                     });
+
+    std::unique_ptr<std::atomic<bool>[]> done(
+        new std::atomic<bool>[num_tiles]);
+    for (camp::idx_t t = 0; t < num_tiles; ++t) {
+      done[t].store(false, std::memory_order_relaxed);
+    }
+    std::atomic<bool>* const done_ptr = done.get();
+    const camp::idx_t* const order_ptr = order.data();
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename CollapseSegmentTypes<Types, Data, HpArgumentId, Args...>::type;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+      camp::idx_t tile[num_dims];
+
+#pragma omp for schedule(dynamic, 1) nowait
+      for (camp::idx_t n = 0; n < num_tiles; ++n) {
+        const camp::idx_t t = order_ptr[n];
+        decode(t, tiles, tile);
+
+        // wait for the tiles just below this one along each index
+        camp::idx_t stride = 1;
+        for (camp::idx_t d = num_dims - 1; d >= 0; --d) {
+          if (tile[d] > 0) {
+            while (!done_ptr[t - stride].load(std::memory_order_acquire)) {
+              std::this_thread::yield();
+            }
+          }
+          stride *= tiles[d];
+        }
+
+        run_tile<NewTypes>(private_data, space, tile);
+
+        done_ptr[t].store(true, std::memory_order_release);
+      }
+    }
+  }
+
+private:
+  static RAJA_INLINE void decode(camp::idx_t t,
+                                 const camp::idx_t (&tiles)[num_dims],
+                                 camp::idx_t (&tile)[num_dims])
+  {
+    for (camp::idx_t d = num_dims - 1; d > 0; --d) {
+      tile[d] = t % tiles[d];
+      t /= tiles[d];
+    }
+    tile[0] = t;
+  }
+
+  template <typename NewTypes, typename Data>
+  static RAJA_INLINE void run_tile(Data& data,
+                                   const space_t& space,
+                                   const camp::idx_t (&tile)[num_dims])
+  {
+    camp::idx_t first[num_dims];
+    camp::idx_t end[num_dims];
+    camp::idx_t index[num_dims];
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      first[d] = tile[d] * TileSize;
+      end[d] = std::min<camp::idx_t>(first[d] + TileSize, space.lengths[d]);
+      index[d] = first[d];
+    }
+
+    for (;;) {
+      space_t::assign_offsets(data, index);
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+
+      camp::idx_t d = num_dims - 1;
+      while (d >= 0 && ++index[d] == end[d]) {
+        index[d] = first[d];
+        --d;
+      }
+      if (d < 0) return;
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
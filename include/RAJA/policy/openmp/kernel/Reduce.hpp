@@ -0,0 +1,164 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP reduce executor of kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_reduce_HPP
+#define RAJA_policy_openmp_kernel_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include <new>
+#include <vector>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/kernel/Region.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// Executor that handles reductions across the threads of an OpenMP parallel
+// region, e.g. a statement::Region<omp_parallel_region>, in which every
+// thread holds a private copy of the parameters.
+//
+// The values of ParamId are combined pairwise in a tree with log2 of the
+// number of threads steps, separated by barriers, so every thread must reach
+// the statement. Thread 0 receives the reduced value and is the only one to
+// execute the enclosed statements. Afterwards every thread is reset to the
+// identity of the operator, so the parameter can be accumulated and reduced
+// again, e.g. once per row. The values the threads start accumulating from
+// must be the identity too.
+//
+// Inside a statement::Region<omp_parallel_region> the partial values live in
+// the scratch the region allocated for its team. In any other parallel
+// region they are allocated every time the statement executes.
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using value_t = camp::decay<decltype(data.template get_param<ParamId>())>;
+
+    const int num_threads = omp_get_num_threads();
+    const int thread = omp_get_thread_num();
+
+    OmpRegionScratch *scratch = omp_region_scratch();
+    if (scratch == nullptr ||
+        !scratch->fits(sizeof(value_t), alignof(value_t), num_threads)) {
+      exec_allocating(data, num_threads, thread);
+      return;
+    }
+
+    value_t *partial =
+        new (scratch->slot(thread)) value_t(data.template get_param<ParamId>());
+
+    combine(num_threads, thread, [&](int t) -> value_t & {
+      return *static_cast<value_t *>(scratch->slot(t));
+    });
+
+    // slot 0 is read by thread 0 only, so each thread can release its own
+    // slot without waiting for the others
+    if (thread == 0) {
+      data.template assign_param<ParamId>(*partial);
+      partial->~value_t();
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+    } else {
+      partial->~value_t();
+    }
+    reset(data);
+  }
+
+private:
+  // combines the partial values of the team into the one of thread 0
+  template <typename Partial>
+  static RAJA_INLINE void combine(int num_threads, int thread, Partial &&partial)
+  {
+    using value_t = camp::decay<decltype(partial(thread))>;
+    using combiner_t = RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+
+#pragma omp barrier
+    for (int stride = 1; stride < num_threads; stride *= 2) {
+      if (thread % (2 * stride) == 0 && thread + stride < num_threads) {
+        combiner_t{}(partial(thread), partial(thread + stride));
+      }
+#pragma omp barrier
+    }
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void reset(Data &data)
+  {
+    using value_t = camp::decay<decltype(data.template get_param<ParamId>())>;
+    using combiner_t = RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+
+    data.template assign_param<ParamId>(combiner_t::identity());
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec_allocating(Data &data, int num_threads, int thread)
+  {
+    using value_t = camp::decay<decltype(data.template get_param<ParamId>())>;
+    using combiner_t = RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+
+    // one partial value per thread, shared by the team
+    std::vector<value_t> *partials = nullptr;
+#pragma omp single copyprivate(partials)
+    partials = new std::vector<value_t>(num_threads, combiner_t::identity());
+
+    (*partials)[thread] = data.template get_param<ParamId>();
+
+    combine(num_threads, thread, [&](int t) -> value_t & {
+      return (*partials)[t];
+    });
+
+    if (thread == 0) {
+      data.template assign_param<ParamId>((*partials)[0]);
+      delete partials;
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+    }
+    reset(data);
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,138 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP parallel region executor of
+ *          kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_region_HPP
+#define RAJA_policy_openmp_kernel_region_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/kernel/Region.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/pattern/region.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// Team-shared scratch of a statement::Region<omp_parallel_region>, with one
+// slot per thread that is large enough to hold any of the kernel parameters.
+// Statements that combine values across the team, e.g. a
+// statement::Reduce<omp_reduce>, use it instead of allocating every time
+// they execute.
+//
+struct OmpRegionScratch {
+  char *data;
+  std::size_t slot_bytes;
+  int num_slots;
+  int level;
+
+  // whether the calling team can hold values of the given size and
+  // alignment in the scratch, which is only the case for the team that
+  // was started by the region
+  bool fits(std::size_t bytes, std::size_t align, int num_threads) const
+  {
+    return bytes <= slot_bytes && align <= static_cast<std::size_t>(DATA_ALIGN)
+        && num_threads <= num_slots && level == omp_get_level();
+  }
+
+  void *slot(int thread) const { return data + thread * slot_bytes; }
+};
+
+// Scratch of the innermost region the calling thread runs in, or nullptr.
+RAJA_INLINE OmpRegionScratch *&omp_region_scratch()
+{
+  static thread_local OmpRegionScratch *scratch = nullptr;
+  return scratch;
+}
+
+template <typename ParamTList>
+struct omp_region_slot_bytes;
+
+template <typename... Params>
+struct omp_region_slot_bytes<camp::list<Params...>> {
+  // rounded up to whole alignment blocks so the slots of different threads
+  // do not share a cache line
+  static constexpr std::size_t value =
+      (std::max({std::size_t(1), sizeof(Params)...}) + DATA_ALIGN - 1)
+      / DATA_ALIGN * DATA_ALIGN;
+};
+
+//
+// Executor that starts an OpenMP parallel region, in which every thread
+// holds a private copy of the parameters.
+//
+// The team's scratch is allocated once, when the region starts, and is
+// shared by every statement that executes in the region.
+//
+template <typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Region<omp_parallel_region, EnclosedStmts...>,
+                         Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using data_t = camp::decay<Data>;
+    using param_tlist = typename data_t::param_tuple_t::TList;
+
+    const std::size_t slot_bytes = omp_region_slot_bytes<param_tlist>::value;
+    const int num_slots = omp_get_max_threads();
+
+    std::unique_ptr<char, FreeAligned> buffer(
+        allocate_aligned_type<char>(DATA_ALIGN, slot_bytes * num_slots));
+    OmpRegionScratch scratch{buffer.get(), slot_bytes, num_slots,
+                             omp_get_level() + 1};
+
+    RAJA::region<omp_parallel_region>([&]() {
+      OmpRegionScratch *&current = omp_region_scratch();
+      OmpRegionScratch *enclosing = current;
+      current = &scratch;
+
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data_t(data));
+
+      current = enclosing;
+    });
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
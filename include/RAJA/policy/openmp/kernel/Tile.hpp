@@ -0,0 +1,191 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP tile executor of kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_tile_HPP
+#define RAJA_policy_openmp_kernel_tile_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/InitLocalMem.hpp"
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/LocalArray.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Execution policy for statement::Tile distributing the tiles over the
+ * threads of an OpenMP parallel region.
+ *
+ * Each thread works on a private copy of the kernel parameters. Local arrays
+ * in the parameters get per-thread storage aligned to RAJA::DATA_ALIGN for
+ * the whole region, which enclosed InitLocalMem<cpu_tile_mem, ...>
+ * statements use instead of allocating for every tile. This replaces any
+ * storage the arrays had outside the region, which all threads would share.
+ */
+struct omp_parallel_tile_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+};
+
+namespace internal
+{
+
+template <camp::idx_t ArgumentId, typename Types, typename... EnclosedStmts>
+struct OmpTileExecutor {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data& data, camp::idx_t chunk_size)
+  {
+    auto const& segment = camp::get<ArgumentId>(data.segment_tuple);
+    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+    const camp::idx_t num_tiles = tiled_iterable.num_blocks;
+
+    using param_tuple_t = typename camp::decay<Data>::param_tuple_t;
+    using params =
+        camp::make_idx_seq_t<camp::tuple_size<param_tuple_t>::value>;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+
+      std::vector<void*> storage;
+      allocate_local_arrays(private_data, storage, params{});
+      std::vector<void*>* outer_storage = thread_local_mem();
+      thread_local_mem() = &storage;
+
+#pragma omp for
+      for (camp::idx_t tile = 0; tile < num_tiles; ++tile) {
+        camp::get<ArgumentId>(private_data.segment_tuple) =
+            tiled_iterable.it.slice(tile * chunk_size, chunk_size);
+        execute_statement_list<camp::list<EnclosedStmts...>, Types>(
+            private_data);
+      }
+
+      thread_local_mem() = outer_storage;
+      for (void* ptr : storage) {
+        RAJA::free_aligned(ptr);
+      }
+    }
+  }
+
+private:
+  template <typename Data, camp::idx_t... Params>
+  static RAJA_INLINE void allocate_local_arrays(Data& data,
+                                                std::vector<void*>& storage,
+                                                camp::idx_seq<Params...>)
+  {
+    camp::sink((allocate_local_array<Params>(data, storage), 0)...);
+  }
+
+  template <camp::idx_t Param, typename Data>
+  static RAJA_INLINE
+      typename std::enable_if<!is_local_array<camp::decay<
+          camp::tuple_element_t<Param, typename Data::param_tuple_t>>>::value>::type
+      allocate_local_array(Data&, std::vector<void*>&)
+  {
+  }
+
+  template <camp::idx_t Param, typename Data>
+  static RAJA_INLINE
+      typename std::enable_if<is_local_array<camp::decay<
+          camp::tuple_element_t<Param, typename Data::param_tuple_t>>>::value>::type
+      allocate_local_array(Data& data, std::vector<void*>& storage)
+  {
+    auto& array = camp::get<Param>(data.param_tuple);
+
+    using value_type = typename camp::decay<decltype(array)>::value_type;
+    static_assert(std::is_trivially_default_constructible<value_type>::value &&
+                      std::is_trivially_destructible<value_type>::value,
+                  "omp_parallel_tile_exec local arrays must hold trivial types");
+
+    // whole cache lines, so threads never share one
+    std::size_t bytes = array.size() * sizeof(value_type);
+    bytes = (bytes + RAJA::DATA_ALIGN - 1) / RAJA::DATA_ALIGN *
+            RAJA::DATA_ALIGN;
+    value_type* ptr =
+        RAJA::allocate_aligned_type<value_type>(RAJA::DATA_ALIGN, bytes);
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("omp_parallel_tile_exec: local array allocation failed");
+    }
+    storage.push_back(ptr);
+    array.set_data(ptr);
+  }
+};
+
+/*!
+ * Tile statement executors for omp_parallel_tile_exec
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t ChunkSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Tile<ArgumentId,
+                                         tile_fixed<ChunkSize>,
+                                         omp_parallel_tile_exec,
+                                         EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data& data)
+  {
+    OmpTileExecutor<ArgumentId, Types, EnclosedStmts...>::exec(
+        data, tile_fixed<ChunkSize>::chunk_size);
+  }
+};
+
+template <camp::idx_t ArgumentId, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Tile<ArgumentId,
+                                         tile_dynamic<ArgumentId>,
+                                         omp_parallel_tile_exec,
+                                         EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data& data)
+  {
+    auto chunk_size = camp::get<ArgumentId>(data.param_tuple);
+    static_assert(camp::concepts::metalib::is_same<TileSize, decltype(chunk_size)>::value,
+                  "Extracted parameter must be of type TileSize.");
+
+    OmpTileExecutor<ArgumentId, Types, EnclosedStmts...>::exec(
+        data, chunk_size.size);
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
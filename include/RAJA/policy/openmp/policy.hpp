@@ -22,6 +22,8 @@
 
 #include "RAJA/policy/PolicyBase.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
+
 // Rely on builtin_atomic when OpenMP can't do the job
 #include "RAJA/policy/atomic_builtin.hpp"
 
@@ -223,6 +225,15 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 ///
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
+///
+///  Scan policy using a single-pass decoupled look-back scan over tiles of
+///  TileSize elements. Behaves like omp_parallel_for_exec for other patterns.
+///
+template <size_t TileSize = 4096>
+struct omp_lookback_scan_exec : omp_parallel_for_exec {
+  static_assert(TileSize > 0, "TileSize must be positive");
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -244,15 +255,29 @@ using omp_parallel_segit = omp_parallel_for_segit;
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
-struct omp_taskgraph_segit
+/// The WaitPolicy template parameter selects how a thread waits for the
+/// dependencies of a segment to be satisfied; see RAJA::dep_graph.
+///
+template <typename WaitPolicy>
+struct omp_taskgraph_wait_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
+  using wait_policy = WaitPolicy;
 };
 
 ///
-struct omp_taskgraph_interval_segit
+template <typename WaitPolicy>
+struct omp_taskgraph_interval_wait_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
+  using wait_policy = WaitPolicy;
 };
 
+///
+using omp_taskgraph_segit = omp_taskgraph_wait_segit<dep_graph::yield_wait>;
+
+///
+using omp_taskgraph_interval_segit =
+    omp_taskgraph_interval_wait_segit<dep_graph::yield_wait>;
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -267,6 +292,22 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+/// WorkGroup order policy that runs all loops in a single omp parallel
+/// region. The iterations of every loop are split into chunks of ChunkSize
+/// iterations and the (loop, chunk) pairs of all loops are distributed
+/// over the threads with schedule(dynamic).
+///
+template <int ChunkSize = 256>
+struct unordered_omp_flatten_chunk_dynamic
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+  static_assert(ChunkSize > 0,
+                "unordered_omp_flatten_chunk_dynamic requires ChunkSize > 0");
+  static constexpr int chunk_size = ChunkSize;
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -282,6 +323,16 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+struct omp_reduce_padded
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
+///
+struct omp_reduce_reproducible
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
 ///
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
@@ -329,6 +380,11 @@ using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
 
+///
+/// Type alias for single-pass look-back scan
+///
+using policy::omp::omp_lookback_scan_exec;
+
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
 ///
@@ -336,6 +392,18 @@ using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
 
+///
+/// Type aliases for omp iteration over indexset segments using the index set
+/// segment dependency graph
+///
+using policy::omp::omp_taskgraph_segit;
+///
+using policy::omp::omp_taskgraph_interval_segit;
+///
+using policy::omp::omp_taskgraph_wait_segit;
+///
+using policy::omp::omp_taskgraph_interval_wait_segit;
+
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
 /// execution policy. Inner policy types follow.
@@ -392,6 +460,10 @@ namespace expt
 using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
+///
+using policy::omp::omp_reduce_padded;
+///
+using policy::omp::omp_reduce_reproducible;
 
 ///
 /// Type aliases for omp reductions
@@ -400,6 +472,8 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+///
+using policy::omp::unordered_omp_flatten_chunk_dynamic;
 
 }  // namespace RAJA
 
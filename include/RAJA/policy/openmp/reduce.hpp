@@ -32,7 +32,10 @@
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
@@ -67,6 +70,132 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reductions combining into padded per-thread slots are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceOMPPadded
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPPadded<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPPadded>;
+
+  //! one slot per thread, padded so threads do not share cache lines
+  struct RAJA_ALIGNED_ATTR(DATA_ALIGN) Slot {
+    T value;
+  };
+
+  using slot_deleter = FreeAlignedType<Slot, int>;
+
+  std::unique_ptr<Slot, slot_deleter> owned_slots;
+  Slot* slots = nullptr;
+  int num_slots = 0;
+
+  void allocate_slots()
+  {
+    num_slots = omp_get_max_threads();
+    owned_slots = std::unique_ptr<Slot, slot_deleter>(
+        allocate_aligned_type<Slot>(alignof(Slot), num_slots * sizeof(Slot)));
+    slots = owned_slots.get();
+    for (int& i = owned_slots.get_deleter().size; i < num_slots; ++i) {
+      new (&slots[i]) Slot{Base::identity};
+    }
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPPadded() = delete;
+
+  //! constructor requires a default value for the reducer
+  ReduceOMPPadded(T init_val, T identity_ = T()) : Base(init_val, identity_)
+  {
+    allocate_slots();
+  }
+
+  //! copies combine into the slots of the reducer they were copied from
+  ReduceOMPPadded(ReduceOMPPadded const& other)
+      : Base(other), slots(other.slots), num_slots(other.num_slots)
+  {
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    for (int i = 0; i < num_slots; ++i) {
+      slots[i].value = identity_;
+    }
+  }
+
+  ~ReduceOMPPadded()
+  {
+    if (Base::parent) {
+      const int tid = omp_get_thread_num();
+      // threads of nested or oversized teams share thread numbers or have
+      // no slot, so they combine into the parent under a critical section
+      if (omp_get_level() <= 1 && tid < num_slots) {
+        Reduce()(slots[tid].value, Base::my_data);
+      } else {
+#pragma omp critical(ompReducePaddedCritical)
+        Reduce()(Base::parent->local(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    if (!Base::parent) {
+      for (int i = 0; i < num_slots; ++i) {
+        Reduce()(Base::my_data, slots[i].value);
+        slots[i].value = Base::identity;
+      }
+    }
+    return Base::my_data;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_padded, detail::ReduceOMPPadded)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reductions with results independent of the thread count are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceOMPReproducible
+    : public reduce::detail::BaseReproducibleCombinable<
+          T, Reduce, ReduceOMPReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::BaseReproducibleCombinable<
+      T, Reduce, ReduceOMPReproducible<T, Reduce>>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPReproducible() = delete;
+
+  using Base::Base;
+
+  ~ReduceOMPReproducible()
+  {
+#pragma omp critical(ompReduceReproducibleCritical)
+    Base::merge_into_parent();
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_reproducible, detail::ReduceOMPReproducible)
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Old ordered reductions are included below.
@@ -31,6 +31,7 @@
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/scan.hpp"
 
 namespace RAJA
 {
@@ -135,6 +136,9 @@ exclusive_inplace(
 /*!
         \brief explicit inclusive scan given input range, output, function, and
    initial value
+
+   Each thread reduces its block of the input, the per-thread sums are
+   scanned, and each thread then scans its block directly into the output.
 */
 template <typename Policy, typename Iter, typename OutIter, typename BinFn>
 RAJA_INLINE
@@ -142,20 +146,53 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 inclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
-  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> sums(p0, Value());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    Value agg = BinFn::identity();
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      agg = f(agg, begin[i]);
+    }
+    sums[pid] = agg;
+#pragma omp barrier
+#pragma omp single
+    exclusive_inplace(host_res, ::RAJA::loop_exec{},
+                      sums.data(), sums.data() + p, f, BinFn::identity());
+    agg = sums[pid];
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      agg = f(agg, begin[i]);
+      out[i] = agg;
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 /*!
         \brief explicit exclusive scan given input range, output, function, and
    initial value
+
+   Each thread reduces its block of the input, the per-thread sums are
+   scanned, and each thread then scans its block directly into the output.
 */
 template <typename Policy,
           typename Iter,
@@ -167,7 +204,7 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 exclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
@@ -175,8 +212,156 @@ exclusive(
     ValueT v)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
-  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> sums(p0, Value());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    Value agg = BinFn::identity();
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      agg = f(agg, begin[i]);
+    }
+    sums[pid] = agg;
+#pragma omp barrier
+#pragma omp single
+    exclusive_inplace(host_res, ::RAJA::loop_exec{},
+                      sums.data(), sums.data() + p, f, v);
+    agg = sums[pid];
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      // read before write so out may alias the input
+      const Value t = begin[i];
+      out[i] = agg;
+      agg = f(agg, t);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+namespace detail
+{
+
+/*!
+        \brief single-pass decoupled look-back scan of [begin, end) into out,
+   which may alias begin
+*/
+template <bool Inclusive,
+          size_t TileSize,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE void omp_lookback_scan(Iter begin,
+                                   Iter end,
+                                   OutIter out,
+                                   BinFn f,
+                                   ValueT v)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return;
+  }
+  ::RAJA::detail::LookbackScan<Value, DistanceT> scan(
+      n, static_cast<DistanceT>(TileSize));
+  const DistanceT num_tiles = scan.num_tiles();
+  const Value init = v;
+#pragma omp parallel for schedule(static, 1) if (num_tiles > 1)
+  for (DistanceT t = 0; t < num_tiles; ++t) {
+    scan.template process_next_tile<Inclusive>(begin, out, f, init);
+  }
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value using a single-pass look-back scan
+*/
+template <size_t TileSize, typename Iter, typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive_inplace(
+    resources::Host host_res,
+    const omp_lookback_scan_exec<TileSize>&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  detail::omp_lookback_scan<true, TileSize>(
+      begin, end, begin, f, BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value using a single-pass look-back scan
+*/
+template <size_t TileSize, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive_inplace(
+    resources::Host host_res,
+    const omp_lookback_scan_exec<TileSize>&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  detail::omp_lookback_scan<false, TileSize>(begin, end, begin, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value using a single-pass look-back scan
+*/
+template <size_t TileSize, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive(
+    resources::Host host_res,
+    const omp_lookback_scan_exec<TileSize>&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  detail::omp_lookback_scan<true, TileSize>(
+      begin, end, out, f, BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value using a single-pass look-back scan
+*/
+template <size_t TileSize,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive(
+    resources::Host host_res,
+    const omp_lookback_scan_exec<TileSize>&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  detail::omp_lookback_scan<false, TileSize>(begin, end, out, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 }  // namespace scan
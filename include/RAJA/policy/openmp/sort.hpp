@@ -23,12 +23,17 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/sort.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
@@ -49,7 +54,101 @@ namespace openmp
 // this number is arbitrary
 constexpr int get_min_iterates_per_task() { return 128; }
 
+// this number is arbitrary
+constexpr int get_min_iterates_per_radix_block() { return 4096; }
+
+/*!
+        \brief number of blocks for a radix sort of n elements, one per thread
+               unless that leaves too little work per block
+*/
+template <typename diff_type>
+inline diff_type radix_num_blocks(diff_type n)
+{
+  const diff_type max_threads = omp_get_max_threads();
+  return std::max(std::min(n/get_min_iterates_per_radix_block(), max_threads),
+                  diff_type(1));
+}
+
+/*!
+        \brief Functional that runs the blocks of a radix sort in an
+               'omp parallel for' loop
+*/
+struct ForEachBlock
+{
+  template < typename diff_type, typename Func >
+  RAJA_INLINE
+  void operator()(diff_type num_blocks, Func&& func) const
+  {
+#pragma omp parallel for schedule(static, 1) if (num_blocks > 1)
+    for (diff_type block = 0; block < num_blocks; ++block) {
+      func(block);
+    }
+  }
+};
+
 #ifdef RAJA_ENABLE_OPENMP_TASK
+/*!
+        \brief merge ranges [i_begin, i_middle) and [i_middle, i_end) using
+               comparison function by spawning tasks that each merge a part
+               of the output into the scratch buffer
+*/
+template <typename Iter, typename Compare>
+inline void merge_task(Iter begin,
+                       RAJA::detail::IterDiff<Iter> i_begin,
+                       RAJA::detail::IterDiff<Iter> i_middle,
+                       RAJA::detail::IterDiff<Iter> i_end,
+                       RAJA::detail::IterDiff<Iter> iterates_per_task,
+                       Compare comp,
+                       RAJA::detail::IterVal<Iter>* buf)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+  const diff_type n = i_end - i_begin;
+  const diff_type num_parts = (n + iterates_per_task - 1) / iterates_per_task;
+
+  // split the output before any task moves from the input
+  std::vector<diff_type> splits(num_parts + 1);
+  for (diff_type part = 0; part <= num_parts; ++part) {
+    splits[part] = RAJA::detail::merge_path_search(
+        begin + i_begin, i_middle - i_begin,
+        begin + i_middle, i_end - i_middle,
+        std::min(part * iterates_per_task, n), comp);
+  }
+  diff_type* splits_ptr = splits.data();
+
+  for (diff_type part = 0; part < num_parts; ++part) {
+
+#pragma omp task
+    {
+      const diff_type o_begin = part * iterates_per_task;
+      const diff_type o_end = std::min(o_begin + iterates_per_task, n);
+      const diff_type a_begin = splits_ptr[part];
+      const diff_type a_end = splits_ptr[part + 1];
+      RAJA::detail::uninitialized_move_merge(
+          begin + i_begin + a_begin, begin + i_begin + a_end,
+          begin + i_middle + (o_begin - a_begin), begin + i_middle + (o_end - a_end),
+          buf + i_begin + o_begin, comp);
+    }
+  }
+
+#pragma omp taskwait
+
+  for (diff_type part = 0; part < num_parts; ++part) {
+
+#pragma omp task
+    {
+      const diff_type o_begin = part * iterates_per_task;
+      const diff_type o_end = std::min(o_begin + iterates_per_task, n);
+      for (diff_type i = i_begin + o_begin; i < i_begin + o_end; ++i) {
+        begin[i] = std::move(buf[i]);
+        buf[i].~value_type();
+      }
+    }
+  }
+
+#pragma omp taskwait
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by spawning tasks
@@ -60,7 +159,8 @@ inline void sort_task(Sorter sorter,
                       RAJA::detail::IterDiff<Iter> i_begin,
                       RAJA::detail::IterDiff<Iter> i_end,
                       RAJA::detail::IterDiff<Iter> iterates_per_task,
-                      Compare comp)
+                      Compare comp,
+                      RAJA::detail::IterVal<Iter>* buf)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
   const diff_type n = i_end - i_begin;
@@ -74,15 +174,16 @@ inline void sort_task(Sorter sorter,
     const diff_type i_middle = i_begin + n/2;
 
 #pragma omp task
-    sort_task(sorter, begin, i_begin, i_middle, iterates_per_task, comp);
+    sort_task(sorter, begin, i_begin, i_middle, iterates_per_task, comp, buf);
 
 #pragma omp task
-    sort_task(sorter, begin, i_middle, i_end, iterates_per_task, comp);
+    sort_task(sorter, begin, i_middle, i_end, iterates_per_task, comp, buf);
 
 #pragma omp taskwait
 
-    //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-    RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    if (comp(begin[i_middle], begin[i_middle-1])) {
+      merge_task(begin, i_begin, i_middle, i_end, iterates_per_task, comp, buf);
+    }
   }
 }
 
@@ -96,38 +197,77 @@ template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
                                  RAJA::detail::IterDiff<Iter> n,
-                                 Compare comp)
+                                 Compare comp,
+                                 RAJA::detail::IterVal<Iter>* buf)
 {
   using RAJA::detail::firstIndex;
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   const diff_type num_threads = omp_get_num_threads();
 
   const diff_type thread_id = omp_get_thread_num();
 
-  const diff_type i_begin = firstIndex(n, num_threads, thread_id);
   {
+    const diff_type i_begin = firstIndex(n, num_threads, thread_id);
     const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
 
     // this thread sorts range [i_begin, i_end)
     sorter(begin + i_begin, begin + i_end, comp);
   }
 
-  // hierarchically merge ranges
+  // hierarchically merge ranges, all the threads that sorted the ranges
+  // being merged take part in the merge
   for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
 
     diff_type end_offset = 2*middle_offset;
 
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
+    const diff_type group_begin = thread_id - thread_id % end_offset;
+    const diff_type group_rank  = thread_id - group_begin;
+    const diff_type group_size  = std::min(end_offset, num_threads - group_begin);
+
+    const diff_type i_begin  = firstIndex(n, num_threads, group_begin);
+    const diff_type i_middle = firstIndex(n, num_threads, std::min(group_begin + middle_offset, num_threads));
+    const diff_type i_end    = firstIndex(n, num_threads, std::min(group_begin + end_offset,    num_threads));
 
 #pragma omp barrier
 
-    if (thread_id % end_offset == 0) {
+    const bool needs_merge = i_begin != i_middle && i_middle != i_end &&
+                             comp(begin[i_middle], begin[i_middle-1]);
+
+    // this thread merges part [o_begin, o_end) of the merged range, taking
+    // [a_begin, a_end) from the first range and the rest from the second
+    const diff_type o_begin = firstIndex(i_end - i_begin, group_size, group_rank);
+    const diff_type o_end   = firstIndex(i_end - i_begin, group_size, group_rank + 1);
+
+    diff_type a_begin = 0;
+    diff_type a_end   = 0;
+    if (needs_merge) {
+      a_begin = RAJA::detail::merge_path_search(begin + i_begin, i_middle - i_begin,
+                                                begin + i_middle, i_end - i_middle,
+                                                o_begin, comp);
+      a_end   = RAJA::detail::merge_path_search(begin + i_begin, i_middle - i_begin,
+                                                begin + i_middle, i_end - i_middle,
+                                                o_end, comp);
+    }
+
+    // all searches must finish before the input is moved from
+#pragma omp barrier
 
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    if (needs_merge) {
+      RAJA::detail::uninitialized_move_merge(
+          begin + i_begin + a_begin, begin + i_begin + a_end,
+          begin + i_middle + (o_begin - a_begin), begin + i_middle + (o_end - a_end),
+          buf + i_begin + o_begin, comp);
+    }
+
+#pragma omp barrier
+
+    if (needs_merge) {
+      for (diff_type i = i_begin + o_begin; i < i_begin + o_end; ++i) {
+        begin[i] = std::move(buf[i]);
+        buf[i].~value_type();
+      }
     }
   }
 }
@@ -146,6 +286,7 @@ void sort(Sorter sorter,
           Compare comp)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
 
@@ -159,25 +300,37 @@ void sort(Sorter sorter,
 
     const diff_type max_threads = omp_get_max_threads();
 
+    // scratch storage shared by all of the merges
+    std::unique_ptr<value_type, FreeAligned> buf(
+        RAJA::allocate_aligned_type<value_type>(RAJA::DATA_ALIGN, n * sizeof(value_type)));
+
+    if (buf == nullptr) {
+      RAJA_ABORT_OR_THROW("openmp sort temporary memory allocation failed");
+    }
+
 #ifdef RAJA_ENABLE_OPENMP_TASK
 
     const diff_type iterates_per_task = std::max(n/(2*max_threads), min_iterates_per_task);
 
     const diff_type requested_num_threads = std::min((n+iterates_per_task-1)/iterates_per_task, max_threads);
 
+    value_type* buf_ptr = buf.get();
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
 #pragma omp master
     {
-      sort_task(sorter, begin, 0, n, iterates_per_task, comp);
+      sort_task(sorter, begin, 0, n, iterates_per_task, comp, buf_ptr);
     }
 
 #else
 
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
 
+    value_type* buf_ptr = buf.get();
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+      sort_parallel_region(sorter, begin, n, comp, buf_ptr);
     }
 
 #endif
@@ -193,7 +346,8 @@ void sort(Sorter sorter,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable<Iter, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -211,7 +365,8 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable<Iter, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -229,7 +384,8 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -251,7 +407,8 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -268,6 +425,86 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort given range of arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable<Iter, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::radix_sort(detail::openmp::ForEachBlock{}, detail::openmp::radix_num_blocks(end - begin), begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable<Iter, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::radix_sort(detail::openmp::ForEachBlock{}, detail::openmp::radix_num_blocks(end - begin), begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::radix_sort_pairs(detail::openmp::ForEachBlock{}, detail::openmp::radix_num_blocks(keys_end - keys_begin),
+                                 keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::radix_sort_pairs(detail::openmp::ForEachBlock{}, detail::openmp::radix_num_blocks(keys_end - keys_begin),
+                                 keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -35,6 +35,17 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
+    const int num_threads = tuned_launch_threads(ctx);
+    if (num_threads > 0) {
+#pragma omp parallel num_threads(num_threads)
+      {
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+        loop_body.get_priv()(ctx);
+      }
+      return;
+    }
+
     RAJA::region<RAJA::omp_parallel_region>([&]() {
       using RAJA::internal::thread_privatize;
       auto loop_body = thread_privatize(body);
@@ -46,11 +57,7 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   static resources::EventProxy<resources::Resource>
   exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
   {
-    RAJA::region<RAJA::omp_parallel_region>([&]() {
-      using RAJA::internal::thread_privatize;
-      auto loop_body = thread_privatize(body);
-      loop_body.get_priv()(ctx);
-    });
+    exec(ctx, body);
 
     return resources::EventProxy<resources::Resource>(res);
   }
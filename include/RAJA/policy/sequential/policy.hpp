@@ -84,6 +84,17 @@ struct seq_reduce : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                           Platform::host> {
 };
 
+///
+/// Reduction whose result matches omp_reduce_reproducible and
+/// tbb_reduce_reproducible for any number of threads
+///
+struct seq_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -100,6 +111,7 @@ struct seq_atomic {
 using policy::sequential::seq_atomic;
 using policy::sequential::seq_exec;
 using policy::sequential::seq_reduce;
+using policy::sequential::seq_reduce_reproducible;
 using policy::sequential::seq_region;
 using policy::sequential::seq_segit;
 using policy::sequential::seq_work;
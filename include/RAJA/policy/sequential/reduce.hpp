@@ -26,6 +26,7 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
@@ -55,6 +56,29 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(seq_reduce, detail::ReduceSeq)
 
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceSeqReproducible
+    : public reduce::detail::BaseReproducibleCombinable<
+          T, Reduce, ReduceSeqReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::BaseReproducibleCombinable<
+      T, Reduce, ReduceSeqReproducible<T, Reduce>>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceSeqReproducible() = delete;
+
+  using Base::Base;
+
+  ~ReduceSeqReproducible() { Base::merge_into_parent(); }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(seq_reduce_reproducible, detail::ReduceSeqReproducible)
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
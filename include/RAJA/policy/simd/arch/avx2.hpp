@@ -0,0 +1,162 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the AVX2 SimdRegister specialization.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_arch_avx2_HPP
+#define RAJA_policy_simd_arch_avx2_HPP
+
+#include "RAJA/policy/simd/register.hpp"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace RAJA
+{
+
+/*!
+ * Four doubles in a __m256d.
+ *
+ * Partial loads and stores use maskload/maskstore, so the lanes past the
+ * end of the data are never accessed, and strided loads use a gather.
+ * AVX2 has no scatter, so strided stores write the register to a temporary
+ * once and copy the lanes out from there.
+ */
+template <>
+class SimdRegister<double, simd_avx2_arch>
+    : public SimdRegisterBase<SimdRegister<double, simd_avx2_arch>, double>
+{
+public:
+  using arch_type = simd_avx2_arch;
+
+  static constexpr camp::idx_t num_lanes = 4;
+
+  RAJA_INLINE SimdRegister() : m_value(_mm256_setzero_pd()) {}
+
+  RAJA_INLINE SimdRegister(double c) : m_value(_mm256_set1_pd(c)) {}
+
+  RAJA_INLINE explicit SimdRegister(__m256d value) : m_value(value) {}
+
+  RAJA_INLINE SimdRegister &load(double const *ptr)
+  {
+    m_value = _mm256_loadu_pd(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister &load_n(double const *ptr, camp::idx_t n)
+  {
+    m_value = _mm256_maskload_pd(ptr, mask(n));
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister &load_strided(double const *ptr,
+                                         camp::idx_t stride,
+                                         camp::idx_t n = num_lanes)
+  {
+    __m256i offsets = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+    m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
+                                       ptr,
+                                       offsets,
+                                       _mm256_castsi256_pd(mask(n)),
+                                       sizeof(double));
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store(double *ptr) const
+  {
+    _mm256_storeu_pd(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store_n(double *ptr, camp::idx_t n) const
+  {
+    _mm256_maskstore_pd(ptr, mask(n), m_value);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store_strided(double *ptr,
+                                                camp::idx_t stride,
+                                                camp::idx_t n = num_lanes) const
+  {
+    alignas(32) double lanes[num_lanes];
+    _mm256_store_pd(lanes, m_value);
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i * stride] = lanes[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE double get(camp::idx_t i) const
+  {
+    double lanes[num_lanes];
+    _mm256_storeu_pd(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE SimdRegister &set(camp::idx_t i, double value)
+  {
+    double lanes[num_lanes];
+    _mm256_storeu_pd(lanes, m_value);
+    lanes[i] = value;
+    m_value = _mm256_loadu_pd(lanes);
+    return *this;
+  }
+
+  RAJA_INLINE double sum() const
+  {
+    __m128d low = _mm256_castpd256_pd128(m_value);
+    __m128d high = _mm256_extractf128_pd(m_value, 1);
+    low = _mm_add_pd(low, high);
+    high = _mm_unpackhi_pd(low, low);
+    return _mm_cvtsd_f64(_mm_add_sd(low, high));
+  }
+
+  RAJA_INLINE SimdRegister add(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm256_add_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister subtract(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm256_sub_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister multiply(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm256_mul_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister divide(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm256_div_pd(m_value, b.m_value));
+  }
+
+private:
+  // all bits set in lanes [0, n)
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                              _mm256_set_epi64x(3, 2, 1, 0));
+  }
+
+  __m256d m_value;
+};
+
+}  // end namespace RAJA
+
+#endif  // closing endif for __AVX2__ guard
+
+#endif  // closing endif for header file include guard
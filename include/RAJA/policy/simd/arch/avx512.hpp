@@ -0,0 +1,156 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the AVX-512 SimdRegister specialization.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_arch_avx512_HPP
+#define RAJA_policy_simd_arch_avx512_HPP
+
+#include "RAJA/policy/simd/register.hpp"
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+namespace RAJA
+{
+
+/*!
+ * Eight doubles in a __m512d.
+ *
+ * Partial and strided accesses use the AVX-512 lane masks, including
+ * scatters for strided stores.
+ */
+template <>
+class SimdRegister<double, simd_avx512_arch>
+    : public SimdRegisterBase<SimdRegister<double, simd_avx512_arch>, double>
+{
+public:
+  using arch_type = simd_avx512_arch;
+
+  static constexpr camp::idx_t num_lanes = 8;
+
+  RAJA_INLINE SimdRegister() : m_value(_mm512_setzero_pd()) {}
+
+  RAJA_INLINE SimdRegister(double c) : m_value(_mm512_set1_pd(c)) {}
+
+  RAJA_INLINE explicit SimdRegister(__m512d value) : m_value(value) {}
+
+  RAJA_INLINE SimdRegister &load(double const *ptr)
+  {
+    m_value = _mm512_loadu_pd(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister &load_n(double const *ptr, camp::idx_t n)
+  {
+    m_value = _mm512_maskz_loadu_pd(mask(n), ptr);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister &load_strided(double const *ptr,
+                                         camp::idx_t stride,
+                                         camp::idx_t n = num_lanes)
+  {
+    m_value = _mm512_mask_i64gather_pd(_mm512_setzero_pd(),
+                                       mask(n),
+                                       offsets(stride),
+                                       ptr,
+                                       sizeof(double));
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store(double *ptr) const
+  {
+    _mm512_storeu_pd(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store_n(double *ptr, camp::idx_t n) const
+  {
+    _mm512_mask_storeu_pd(ptr, mask(n), m_value);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store_strided(double *ptr,
+                                                camp::idx_t stride,
+                                                camp::idx_t n = num_lanes) const
+  {
+    _mm512_mask_i64scatter_pd(
+        ptr, mask(n), offsets(stride), m_value, sizeof(double));
+    return *this;
+  }
+
+  RAJA_INLINE double get(camp::idx_t i) const
+  {
+    double lanes[num_lanes];
+    _mm512_storeu_pd(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE SimdRegister &set(camp::idx_t i, double value)
+  {
+    m_value = _mm512_mask_mov_pd(m_value, mask_lane(i), _mm512_set1_pd(value));
+    return *this;
+  }
+
+  RAJA_INLINE double sum() const { return _mm512_reduce_add_pd(m_value); }
+
+  RAJA_INLINE SimdRegister add(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm512_add_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister subtract(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm512_sub_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister multiply(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm512_mul_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister divide(SimdRegister const &b) const
+  {
+    return SimdRegister(_mm512_div_pd(m_value, b.m_value));
+  }
+
+private:
+  // lanes [0, n)
+  static RAJA_INLINE __mmask8 mask(camp::idx_t n)
+  {
+    return n >= num_lanes ? __mmask8(0xFF) : __mmask8((1u << n) - 1u);
+  }
+
+  static RAJA_INLINE __mmask8 mask_lane(camp::idx_t i)
+  {
+    return __mmask8(1u << i);
+  }
+
+  static RAJA_INLINE __m512i offsets(camp::idx_t stride)
+  {
+    return _mm512_set_epi64(7 * stride, 6 * stride, 5 * stride, 4 * stride,
+                            3 * stride, 2 * stride, stride, 0);
+  }
+
+  __m512d m_value;
+};
+
+}  // end namespace RAJA
+
+#endif  // closing endif for __AVX512F__ guard
+
+#endif  // closing endif for header file include guard
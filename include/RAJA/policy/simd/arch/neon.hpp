@@ -0,0 +1,127 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the NEON SimdRegister specialization.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_arch_neon_HPP
+#define RAJA_policy_simd_arch_neon_HPP
+
+#include "RAJA/policy/simd/register.hpp"
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+#include <arm_neon.h>
+
+namespace RAJA
+{
+
+/*!
+ * Two doubles in a float64x2_t.
+ *
+ * NEON has no masked loads or stores, so a partial access of one lane uses
+ * the single lane forms.
+ */
+template <>
+class SimdRegister<double, simd_neon_arch>
+    : public SimdRegisterBase<SimdRegister<double, simd_neon_arch>, double>
+{
+public:
+  using arch_type = simd_neon_arch;
+
+  static constexpr camp::idx_t num_lanes = 2;
+
+  RAJA_INLINE SimdRegister() : m_value(vdupq_n_f64(0.0)) {}
+
+  RAJA_INLINE SimdRegister(double c) : m_value(vdupq_n_f64(c)) {}
+
+  RAJA_INLINE explicit SimdRegister(float64x2_t value) : m_value(value) {}
+
+  RAJA_INLINE SimdRegister &load(double const *ptr)
+  {
+    m_value = vld1q_f64(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister &load_n(double const *ptr, camp::idx_t n)
+  {
+    if (n >= num_lanes) {
+      m_value = vld1q_f64(ptr);
+    } else if (n == 1) {
+      m_value = vld1q_lane_f64(ptr, vdupq_n_f64(0.0), 0);
+    } else {
+      m_value = vdupq_n_f64(0.0);
+    }
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store(double *ptr) const
+  {
+    vst1q_f64(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store_n(double *ptr, camp::idx_t n) const
+  {
+    if (n >= num_lanes) {
+      vst1q_f64(ptr, m_value);
+    } else if (n == 1) {
+      vst1q_lane_f64(ptr, m_value, 0);
+    }
+    return *this;
+  }
+
+  RAJA_INLINE double get(camp::idx_t i) const
+  {
+    return i == 0 ? vgetq_lane_f64(m_value, 0) : vgetq_lane_f64(m_value, 1);
+  }
+
+  RAJA_INLINE SimdRegister &set(camp::idx_t i, double value)
+  {
+    m_value = i == 0 ? vsetq_lane_f64(value, m_value, 0)
+                     : vsetq_lane_f64(value, m_value, 1);
+    return *this;
+  }
+
+  RAJA_INLINE double sum() const { return vaddvq_f64(m_value); }
+
+  RAJA_INLINE SimdRegister add(SimdRegister const &b) const
+  {
+    return SimdRegister(vaddq_f64(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister subtract(SimdRegister const &b) const
+  {
+    return SimdRegister(vsubq_f64(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister multiply(SimdRegister const &b) const
+  {
+    return SimdRegister(vmulq_f64(m_value, b.m_value));
+  }
+
+  RAJA_INLINE SimdRegister divide(SimdRegister const &b) const
+  {
+    return SimdRegister(vdivq_f64(m_value, b.m_value));
+  }
+
+private:
+  float64x2_t m_value;
+};
+
+}  // end namespace RAJA
+
+#endif  // closing endif for __ARM_NEON guard
+
+#endif  // closing endif for header file include guard
@@ -31,8 +31,11 @@
 #include <iterator>
 #include <type_traits>
 
+#include "RAJA/util/VectorIndex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/policy/simd/policy.hpp"
@@ -62,6 +65,50 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+ * Segments simd_vector_exec can execute: VectorIndex assumes consecutive
+ * indices.
+ */
+template <typename Iterable>
+struct is_vector_segment : std::false_type {
+};
+
+template <typename StorageT, typename DiffT>
+struct is_vector_segment<TypedRangeSegment<StorageT, DiffT>>
+    : std::true_type {
+};
+
+template <typename Iterable, typename Func, typename RegisterType>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host host_res,
+    const simd_vector_exec<RegisterType> &,
+    Iterable &&iter,
+    Func &&loop_body)
+{
+  static_assert(is_vector_segment<camp::decay<Iterable>>::value,
+                "simd_vector_exec requires a TypedRangeSegment");
+
+  using index_type = camp::decay<decltype(*std::begin(iter))>;
+  using vector_index_type = VectorIndex<index_type, RegisterType>;
+  constexpr camp::idx_t num_lanes = RegisterType::num_lanes;
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+
+  decltype(distance) i = 0;
+  for (; i + num_lanes <= distance; i += num_lanes) {
+    loop_body(vector_index_type(*(begin + i), num_lanes));
+  }
+
+  // masked remainder
+  if (i < distance) {
+    loop_body(vector_index_type(*(begin + i), distance - i));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -25,7 +25,9 @@
 
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
+#include "RAJA/policy/simd/forall.hpp"
 #include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/util/VectorIndex.hpp"
 
 namespace RAJA
 {
@@ -129,6 +131,213 @@ struct StatementExecutor<
 };
 
 
+/*!
+ * Extracts a lambda argument inside a simd_vector_exec loop over
+ * ArgumentId. The segment value and offset of ArgumentId are passed as a
+ * VectorIndex of the given length, all other arguments as for
+ * statement::Lambda.
+ */
+template <camp::idx_t ArgumentId, typename RegisterType, typename Types, typename T>
+struct VectorLambdaArgExtractor {
+
+  template <typename Data>
+  static RAJA_INLINE auto extract_arg(Data &&data, camp::idx_t)
+      -> decltype(LambdaArgExtractor<Types, T>::extract_arg(data))
+  {
+    return LambdaArgExtractor<Types, T>::extract_arg(data);
+  }
+};
+
+template <camp::idx_t ArgumentId, typename RegisterType, typename Types>
+struct VectorLambdaArgExtractor<ArgumentId,
+                                RegisterType,
+                                Types,
+                                LambdaArg<lambda_arg_seg_t, ArgumentId>> {
+
+  using index_type = camp::at_v<typename Types::segment_types_t, ArgumentId>;
+  using type = VectorIndex<index_type, RegisterType>;
+
+  template <typename Data>
+  static RAJA_INLINE type extract_arg(Data &&data, camp::idx_t length)
+  {
+    return type(index_type(camp::get<ArgumentId>(data.segment_tuple)
+                               .begin()[camp::get<ArgumentId>(data.offset_tuple)]),
+                length);
+  }
+};
+
+template <camp::idx_t ArgumentId, typename RegisterType, typename Types>
+struct VectorLambdaArgExtractor<ArgumentId,
+                                RegisterType,
+                                Types,
+                                LambdaArg<lambda_arg_offset_t, ArgumentId>> {
+
+  using index_type = camp::at_v<typename Types::offset_types_t, ArgumentId>;
+  using type = VectorIndex<index_type, RegisterType>;
+
+  template <typename Data>
+  static RAJA_INLINE type extract_arg(Data &&data, camp::idx_t length)
+  {
+    return type(index_type(camp::get<ArgumentId>(data.offset_tuple)), length);
+  }
+};
+
+
+/*!
+ *
+ *  Helper structs to invoke a chain of lambdas with vector arguments
+ *
+ */
+template <camp::idx_t ArgumentId, typename RegisterType, typename Types, class Statement>
+struct VectorLambdaInvoker {
+  static_assert(TypeIsLambda<camp::decay<Statement>>::value,
+                "Lambdas are only supported post RAJA::simd_vector_exec");
+};
+
+template <camp::idx_t ArgumentId,
+          typename RegisterType,
+          typename Types,
+          camp::idx_t LambdaIndex,
+          typename... Args>
+struct VectorLambdaInvoker<ArgumentId,
+                           RegisterType,
+                           Types,
+                           statement::Lambda<LambdaIndex, Args...>> {
+
+  template <typename Data>
+  static RAJA_INLINE void invoke(Data &data, camp::idx_t length)
+  {
+    using targList = typename camp::flatten<camp::list<Args...>>::type;
+    invoke_with_args(data, length, targList{});
+  }
+
+  template <typename Data, typename... targLists>
+  static RAJA_INLINE void invoke_with_args(Data &data,
+                                           camp::idx_t length,
+                                           camp::list<targLists...> const &)
+  {
+    camp::get<LambdaIndex>(data.bodies)(
+        VectorLambdaArgExtractor<ArgumentId, RegisterType, Types, targLists>::
+            extract_arg(data, length)...);
+  }
+};
+
+// Lambda<LambdaIndex> passes all segments, then all parameters
+template <camp::idx_t ArgumentId,
+          typename RegisterType,
+          typename Types,
+          camp::idx_t LambdaIndex>
+struct VectorLambdaInvoker<ArgumentId,
+                           RegisterType,
+                           Types,
+                           statement::Lambda<LambdaIndex>> {
+
+  template <typename Data>
+  static RAJA_INLINE void invoke(Data &data, camp::idx_t length)
+  {
+    using data_t = camp::decay<Data>;
+    invoke_expanded(
+        data,
+        length,
+        camp::make_idx_seq_t<camp::tuple_size<typename data_t::offset_tuple_t>::value>{},
+        camp::make_idx_seq_t<camp::tuple_size<typename data_t::param_tuple_t>::value>{});
+  }
+
+  template <typename Data, camp::idx_t... SegIdx, camp::idx_t... ParamIdx>
+  static RAJA_INLINE void invoke_expanded(Data &data,
+                                          camp::idx_t length,
+                                          camp::idx_seq<SegIdx...> const &,
+                                          camp::idx_seq<ParamIdx...> const &)
+  {
+    VectorLambdaInvoker<ArgumentId,
+                        RegisterType,
+                        Types,
+                        statement::Lambda<LambdaIndex,
+                                          Segs<SegIdx...>,
+                                          Params<ParamIdx...>>>::invoke(data,
+                                                                        length);
+  }
+};
+
+template <camp::idx_t ArgumentId, typename RegisterType, typename Types, class... Statements>
+struct Invoke_all_VectorLambda;
+
+template <camp::idx_t ArgumentId, typename RegisterType, typename Types>
+struct Invoke_all_VectorLambda<ArgumentId, RegisterType, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void lambda_special(Data &, camp::idx_t)
+  {
+    // NOP terminator
+  }
+};
+
+template <camp::idx_t ArgumentId,
+          typename RegisterType,
+          typename Types,
+          class Statement,
+          class... StatementRest>
+struct Invoke_all_VectorLambda<ArgumentId, RegisterType, Types, Statement, StatementRest...> {
+
+  template <typename Data>
+  static RAJA_INLINE void lambda_special(Data &data, camp::idx_t length)
+  {
+    VectorLambdaInvoker<ArgumentId, RegisterType, Types, Statement>::invoke(
+        data, length);
+
+    Invoke_all_VectorLambda<ArgumentId, RegisterType, Types, StatementRest...>::
+        lambda_special(data, length);
+  }
+};
+
+
+/*!
+ * RAJA::kernel forall_impl executor specialization for statement::For with
+ * simd_vector_exec.
+ * Assumptions: RAJA::simd_vector_exec is the inner most policy and only
+ * lambdas are enclosed. The segment and offset of ArgumentId are passed to
+ * the lambdas as VectorIndex, num_lanes at a time with a shorter one for
+ * the remainder; the segment must be a TypedRangeSegment.
+ */
+template <camp::idx_t ArgumentId,
+          typename RegisterType,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::For<ArgumentId, RAJA::simd_vector_exec<RegisterType>, EnclosedStmts...>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    static_assert(policy::simd::is_vector_segment<camp::decay<
+                      decltype(camp::get<ArgumentId>(data.segment_tuple))>>::value,
+                  "simd_vector_exec requires a TypedRangeSegment");
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    constexpr camp::idx_t num_lanes = RegisterType::num_lanes;
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    len_t i = 0;
+    for (; i + num_lanes <= len; i += num_lanes) {
+      data.template assign_offset<ArgumentId>(i);
+      Invoke_all_VectorLambda<ArgumentId, RegisterType, NewTypes, EnclosedStmts...>::
+          lambda_special(data, num_lanes);
+    }
+
+    // masked remainder
+    if (i < len) {
+      data.template assign_offset<ArgumentId>(i);
+      Invoke_all_VectorLambda<ArgumentId, RegisterType, NewTypes, EnclosedStmts...>::
+          lambda_special(data, len - i);
+    }
+  }
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
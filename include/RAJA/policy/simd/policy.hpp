@@ -20,6 +20,8 @@
 
 #include "RAJA/policy/PolicyBase.hpp"
 
+#include "RAJA/policy/simd/register.hpp"
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -44,11 +46,27 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+/*!
+ * Executes a contiguous range num_lanes indices at a time, passing the loop
+ * body a VectorIndex for RegisterType instead of a scalar index; the last
+ * VectorIndex holds the remaining indices when the length is not a multiple
+ * of num_lanes. Views indexed with it load and store whole registers.
+ */
+template <typename RegisterType = simd_register<double>>
+struct simd_vector_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  using register_type = RegisterType;
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::simd_vector_exec;
 
 }  // end of namespace RAJA
 
@@ -0,0 +1,302 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA SIMD register types used by
+ *          simd_vector_exec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_register_HPP
+#define RAJA_policy_simd_register_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Register architecture tags, selecting the instructions a SimdRegister is
+ * implemented with.
+ *
+ * simd_scalar_arch stores the lanes in an array and leaves vectorization to
+ * the compiler. The other tags use intrinsics for double and are only
+ * available when the compiler targets the instruction set, e.g. with
+ * -mavx2, -mavx512f or on aarch64; otherwise, and for other element types,
+ * they fall back to the array implementation with the same number of lanes.
+ */
+struct simd_scalar_arch {
+  static constexpr camp::idx_t register_bytes = 32;
+};
+
+struct simd_avx2_arch {
+  static constexpr camp::idx_t register_bytes = 32;
+};
+
+struct simd_avx512_arch {
+  static constexpr camp::idx_t register_bytes = 64;
+};
+
+struct simd_neon_arch {
+  static constexpr camp::idx_t register_bytes = 16;
+};
+
+/*!
+ * The widest register architecture the compiler targets.
+ */
+#if defined(__AVX512F__)
+using simd_native_arch = simd_avx512_arch;
+#elif defined(__AVX2__)
+using simd_native_arch = simd_avx2_arch;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+using simd_native_arch = simd_neon_arch;
+#else
+using simd_native_arch = simd_scalar_arch;
+#endif
+
+
+/*!
+ * Operations shared by all SimdRegister implementations.
+ *
+ * Derived provides num_lanes, load, load_n, store, store_n, get, set, add,
+ * subtract, multiply and divide; the strided accesses and the horizontal
+ * sum below go through get and set and are replaced by intrinsics where the
+ * architecture has them.
+ */
+template <typename Derived, typename T>
+class SimdRegisterBase
+{
+public:
+  using element_type = T;
+
+  /*!
+   * Loads lanes [0, n) from ptr[0], ptr[stride], ... and zeroes the others.
+   */
+  RAJA_INLINE Derived &load_strided(T const *ptr,
+                                    camp::idx_t stride,
+                                    camp::idx_t n = Derived::num_lanes)
+  {
+    for (camp::idx_t i = 0; i < Derived::num_lanes; ++i) {
+      derived().set(i, i < n ? ptr[i * stride] : T(0));
+    }
+    return derived();
+  }
+
+  /*!
+   * Stores lanes [0, n) to ptr[0], ptr[stride], ...
+   */
+  RAJA_INLINE Derived const &store_strided(T *ptr,
+                                           camp::idx_t stride,
+                                           camp::idx_t n = Derived::num_lanes) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i * stride] = derived().get(i);
+    }
+    return derived();
+  }
+
+  /*!
+   * Sum of all lanes.
+   */
+  RAJA_INLINE T sum() const
+  {
+    T result(0);
+    for (camp::idx_t i = 0; i < Derived::num_lanes; ++i) {
+      result += derived().get(i);
+    }
+    return result;
+  }
+
+  RAJA_INLINE Derived &operator+=(Derived const &b)
+  {
+    return derived() = derived().add(b);
+  }
+
+  RAJA_INLINE Derived &operator-=(Derived const &b)
+  {
+    return derived() = derived().subtract(b);
+  }
+
+  RAJA_INLINE Derived &operator*=(Derived const &b)
+  {
+    return derived() = derived().multiply(b);
+  }
+
+  RAJA_INLINE Derived &operator/=(Derived const &b)
+  {
+    return derived() = derived().divide(b);
+  }
+
+  RAJA_INLINE friend Derived operator+(Derived const &a, Derived const &b)
+  {
+    return a.add(b);
+  }
+
+  RAJA_INLINE friend Derived operator-(Derived const &a, Derived const &b)
+  {
+    return a.subtract(b);
+  }
+
+  RAJA_INLINE friend Derived operator*(Derived const &a, Derived const &b)
+  {
+    return a.multiply(b);
+  }
+
+  RAJA_INLINE friend Derived operator/(Derived const &a, Derived const &b)
+  {
+    return a.divide(b);
+  }
+
+  RAJA_INLINE friend Derived operator-(Derived const &a)
+  {
+    return Derived().subtract(a);
+  }
+
+private:
+  RAJA_INLINE Derived &derived() { return *static_cast<Derived *>(this); }
+
+  RAJA_INLINE Derived const &derived() const
+  {
+    return *static_cast<Derived const *>(this);
+  }
+};
+
+
+/*!
+ * A SIMD register of T with as many lanes as fit in a register of Arch.
+ *
+ * Default construction zeroes all lanes and construction from a T broadcasts
+ * it, so scalars mix freely with registers in arithmetic. The _n variants of
+ * load and store only touch the first n lanes, which handles the remainder
+ * of a loop whose length is not a multiple of num_lanes.
+ */
+template <typename T, typename Arch = simd_native_arch>
+class SimdRegister : public SimdRegisterBase<SimdRegister<T, Arch>, T>
+{
+public:
+  using arch_type = Arch;
+
+  static constexpr camp::idx_t num_lanes =
+      Arch::register_bytes / camp::idx_t(sizeof(T)) > 0
+          ? Arch::register_bytes / camp::idx_t(sizeof(T))
+          : 1;
+
+  RAJA_INLINE SimdRegister() : m_value{} {}
+
+  RAJA_INLINE SimdRegister(T c)
+  {
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      m_value[i] = c;
+    }
+  }
+
+  RAJA_INLINE SimdRegister &load(T const *ptr)
+  {
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      m_value[i] = ptr[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister &load_n(T const *ptr, camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      m_value[i] = i < n ? ptr[i] : T(0);
+    }
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store(T *ptr) const
+  {
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      ptr[i] = m_value[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister const &store_n(T *ptr, camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i] = m_value[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE T get(camp::idx_t i) const { return m_value[i]; }
+
+  RAJA_INLINE SimdRegister &set(camp::idx_t i, T value)
+  {
+    m_value[i] = value;
+    return *this;
+  }
+
+  RAJA_INLINE SimdRegister add(SimdRegister const &b) const
+  {
+    SimdRegister result;
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      result.m_value[i] = m_value[i] + b.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE SimdRegister subtract(SimdRegister const &b) const
+  {
+    SimdRegister result;
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      result.m_value[i] = m_value[i] - b.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE SimdRegister multiply(SimdRegister const &b) const
+  {
+    SimdRegister result;
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      result.m_value[i] = m_value[i] * b.m_value[i];
+    }
+    return result;
+  }
+
+  RAJA_INLINE SimdRegister divide(SimdRegister const &b) const
+  {
+    SimdRegister result;
+    for (camp::idx_t i = 0; i < num_lanes; ++i) {
+      result.m_value[i] = m_value[i] / b.m_value[i];
+    }
+    return result;
+  }
+
+private:
+  T m_value[num_lanes];
+};
+
+template <typename T, typename Arch>
+constexpr camp::idx_t SimdRegister<T, Arch>::num_lanes;
+
+
+/*!
+ * Register of T for the widest architecture the compiler targets.
+ */
+template <typename T>
+using simd_register = SimdRegister<T, simd_native_arch>;
+
+}  // end namespace RAJA
+
+#include "RAJA/policy/simd/arch/avx2.hpp"
+#include "RAJA/policy/simd/arch/avx512.hpp"
+#include "RAJA/policy/simd/arch/neon.hpp"
+
+#endif  // closing endif for header file include guard
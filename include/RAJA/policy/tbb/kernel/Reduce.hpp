@@ -0,0 +1,141 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the TBB reduce executor of kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Reduce_HPP
+#define RAJA_policy_tbb_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <cstddef>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+RAJA_INLINE std::size_t tbb_grain_size(tbb_for_dynamic const &p)
+{
+  return p.grain_size;
+}
+
+template <std::size_t GrainSize>
+RAJA_INLINE std::size_t tbb_grain_size(tbb_for_static<GrainSize> const &)
+{
+  return GrainSize;
+}
+
+//
+// Executor that handles reductions for TBB
+//
+// TBB has no parallel region in which every thread reaches the Reduce
+// statement, so the statement encloses the parallel loop producing the
+// values, which must be its first statement:
+//
+//   Reduce<tbb_reduce, operators::plus, Param<0>,
+//     For<1, tbb_for_exec, Lambda<0>>,   // accumulate into Param<0>
+//     Lambda<1>                          // use the reduced value
+//   >
+//
+// The loop runs as a tbb::parallel_reduce: every range accumulates into a
+// private copy of the parameters starting from the identity of the
+// operator, and the partial values are combined in TBB's join tree. The
+// result is combined with the value the parameter held before the loop, as
+// in a sequential run, and the remaining statements execute once.
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          camp::idx_t ArgumentId,
+          typename ForPolicy,
+          typename... ForStmts,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<tbb_reduce,
+                      ReduceOperator,
+                      ParamId,
+                      statement::For<ArgumentId, ForPolicy, ForStmts...>,
+                      EnclosedStmts...>, Types> {
+
+  static_assert(type_traits::is_tbb_policy<ForPolicy>::value,
+                "Reduce<tbb_reduce, ...> must enclose a For with a TBB policy");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using data_t = camp::decay<Data>;
+    using value_t = camp::decay<decltype(data.template get_param<ParamId>())>;
+    using combiner_t = RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+
+    // Set the argument type for the loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    using brange = ::tbb::blocked_range<std::size_t>;
+    const brange range(0,
+                       static_cast<std::size_t>(RAJA::stripIndexType(len)),
+                       tbb_grain_size(ForPolicy{}));
+
+    const data_t &shared_data = data;
+    value_t loop_value = ::tbb::parallel_reduce(
+        range,
+        combiner_t::identity(),
+        [&](const brange &r, value_t value) -> value_t {
+          data_t private_data(shared_data);
+          private_data.template assign_param<ParamId>(value);
+          for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            private_data.template assign_offset<ArgumentId>(len_t(i));
+            execute_statement_list<camp::list<ForStmts...>, NewTypes>(
+                private_data);
+          }
+          return private_data.template get_param<ParamId>();
+        },
+        [](value_t lhs, value_t rhs) -> value_t {
+          combiner_t{}(lhs, rhs);
+          return lhs;
+        });
+
+    value_t value = data.template get_param<ParamId>();
+    combiner_t{}(value, loop_value);
+    data.template assign_param<ParamId>(value);
+
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
@@ -60,6 +60,15 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// Scan policy using a single-pass decoupled look-back scan over tiles of
+/// TileSize elements. Behaves like tbb_for_exec for other patterns.
+///
+template <std::size_t TileSize = 4096>
+struct tbb_lookback_scan_exec : tbb_for_exec {
+  static_assert(TileSize > 0, "TileSize must be positive");
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -88,13 +97,23 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                           Platform::host> {
 };
 
+///
+struct tbb_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 }  // namespace tbb
 }  // namespace policy
 
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
+using policy::tbb::tbb_lookback_scan_exec;
 using policy::tbb::tbb_reduce;
+using policy::tbb::tbb_reduce_reproducible;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
 
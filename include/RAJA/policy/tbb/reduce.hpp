@@ -33,6 +33,7 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/tbb/policy.hpp"
@@ -86,6 +87,52 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceTBBReproducible
+{
+  using accumulator_type = reduce::detail::ReproducibleAccumulator<T, Reduce>;
+
+  //! TBB native per-thread container
+  std::shared_ptr<tbb::combinable<accumulator_type>> data;
+
+public:
+  //! default constructor calls the reset method
+  ReduceTBBReproducible() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceTBBReproducible(T init_val, T initializer)
+  {
+    reset(init_val, initializer);
+  }
+
+  void reset(T init_val, T initializer)
+  {
+    data = std::make_shared<tbb::combinable<accumulator_type>>(
+        [=]() { return accumulator_type{initializer}; });
+    data->local().add(init_val);
+  }
+
+  /*!
+   *  \return the calculated reduced value
+   */
+  T get() const
+  {
+    accumulator_type res{Reduce::identity()};
+    data->combine_each([&](accumulator_type const& v) { res.add(v); });
+    return res.get();
+  }
+
+  /*!
+   *  \return update the local value
+   */
+  void combine(const T& other) { data->local().add(other); }
+};
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(tbb_reduce_reproducible, detail::ReduceTBBReproducible)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
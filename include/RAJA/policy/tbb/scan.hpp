@@ -28,8 +28,10 @@
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/scan.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
 
 namespace RAJA
 {
@@ -98,6 +100,40 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
     }
   }
 };
+
+/*!
+        \brief single-pass decoupled look-back scan of [begin, end) into out,
+   which may alias begin
+*/
+template <bool Inclusive,
+          std::size_t TileSize,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE void tbb_lookback_scan(Iter begin,
+                                   Iter end,
+                                   OutIter out,
+                                   BinFn f,
+                                   T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = std::distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return;
+  }
+  ::RAJA::detail::LookbackScan<Value, DistanceT> scan(
+      n, static_cast<DistanceT>(TileSize));
+  const Value init = v;
+  tbb::parallel_for(tbb::blocked_range<DistanceT>{0, scan.num_tiles(), 1},
+                    [&](const tbb::blocked_range<DistanceT>& r) {
+                      for (DistanceT t = r.begin(); t != r.end(); ++t) {
+                        scan.template process_next_tile<Inclusive>(
+                            begin, out, f, init);
+                      }
+                    });
+}
 }  // namespace detail
 
 /*!
@@ -216,6 +252,87 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value using a single-pass look-back scan
+*/
+template <std::size_t TileSize, typename Iter, typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive_inplace(
+    resources::Host host_res,
+    const tbb_lookback_scan_exec<TileSize>&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  detail::tbb_lookback_scan<true, TileSize>(
+      begin, end, begin, f, BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value using a single-pass look-back scan
+*/
+template <std::size_t TileSize, typename Iter, typename BinFn, typename T>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive_inplace(
+    resources::Host host_res,
+    const tbb_lookback_scan_exec<TileSize>&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    T v)
+{
+  detail::tbb_lookback_scan<false, TileSize>(begin, end, begin, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value using a single-pass look-back scan
+*/
+template <std::size_t TileSize,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive(
+    resources::Host host_res,
+    const tbb_lookback_scan_exec<TileSize>&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  detail::tbb_lookback_scan<true, TileSize>(
+      begin, end, out, f, BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value using a single-pass look-back scan
+*/
+template <std::size_t TileSize,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive(
+    resources::Host host_res,
+    const tbb_lookback_scan_exec<TileSize>&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  detail::tbb_lookback_scan<false, TileSize>(begin, end, out, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -129,6 +129,35 @@ void tbb_sort(Sorter sorter,
   }
 }
 
+// this number is arbitrary
+constexpr int get_min_iterates_per_radix_block() { return 4096; }
+
+/*!
+        \brief number of blocks for a radix sort of n elements, one per worker
+               unless that leaves too little work per block
+*/
+template <typename diff_type>
+inline diff_type tbb_radix_num_blocks(diff_type n)
+{
+  const diff_type max_workers = tbb::this_task_arena::max_concurrency();
+  return std::max(std::min(n/get_min_iterates_per_radix_block(), max_workers),
+                  diff_type(1));
+}
+
+/*!
+        \brief Functional that runs the blocks of a radix sort with a
+               TBB parallel_for
+*/
+struct TbbForEachBlock
+{
+  template < typename diff_type, typename Func >
+  RAJA_INLINE
+  void operator()(diff_type num_blocks, Func&& func) const
+  {
+    tbb::parallel_for(diff_type(0), num_blocks, func);
+  }
+};
+
 } // namespace detail
 
 /*!
@@ -136,7 +165,8 @@ void tbb_sort(Sorter sorter,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable<Iter, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -154,7 +184,8 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable<Iter, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -172,7 +203,8 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -194,7 +226,8 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -211,6 +244,86 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort given range of arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable<Iter, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::radix_sort(detail::TbbForEachBlock{}, detail::tbb_radix_num_blocks(end - begin), begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable<Iter, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::radix_sort(detail::TbbForEachBlock{}, detail::tbb_radix_num_blocks(end - begin), begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::radix_sort_pairs(detail::TbbForEachBlock{}, detail::tbb_radix_num_blocks(keys_end - keys_begin),
+                                 keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys using radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::radix_sortable_pairs<KeyIter, ValIter, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  RAJA::detail::radix_sort_pairs(detail::TbbForEachBlock{}, detail::tbb_radix_num_blocks(keys_end - keys_begin),
+                                 keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
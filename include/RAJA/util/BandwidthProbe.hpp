@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Bandwidth_Probe_HPP
+#define RAJA_Bandwidth_Probe_HPP
+
+#include "RAJA/config.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * \brief Host memory bandwidth in GB/s measured with the STREAM triad
+ *        a[i] = b[i] + s * c[i].
+ *
+ * The arrays hold num_elements doubles each and should be several times
+ * larger than the last level cache. The best of repetitions runs is
+ * returned, counting 24 bytes per element as STREAM does. With OpenMP the
+ * arrays are first touched and updated by all threads with the same static
+ * schedule, so pages are placed near the threads using them.
+ */
+inline double stream_triad_bandwidth(std::size_t num_elements,
+                                     int repetitions = 5)
+{
+  using clock = std::chrono::steady_clock;
+
+  if (num_elements == 0) return 0.0;
+
+  std::unique_ptr<double[]> a(new double[num_elements]);
+  std::unique_ptr<double[]> b(new double[num_elements]);
+  std::unique_ptr<double[]> c(new double[num_elements]);
+  double* pa = a.get();
+  double* pb = b.get();
+  double* pc = c.get();
+  const long n = static_cast<long>(num_elements);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for (long i = 0; i < n; ++i) {
+    pa[i] = 0.0;
+    pb[i] = 1.0;
+    pc[i] = 2.0;
+  }
+
+  const double scalar = 3.0;
+  double best_seconds = 0.0;
+  for (int r = 0; r < repetitions; ++r) {
+    const clock::time_point start = clock::now();
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (long i = 0; i < n; ++i) {
+      pa[i] = pb[i] + scalar * pc[i];
+    }
+    const double seconds =
+        std::chrono::duration<double>(clock::now() - start).count();
+    if (r == 0 || seconds < best_seconds) best_seconds = seconds;
+  }
+
+  // keep the stores from being optimized away
+  volatile double sink = pa[n / 2];
+  static_cast<void>(sink);
+
+  return best_seconds > 0.0
+             ? 3.0 * sizeof(double) * static_cast<double>(n) / best_seconds *
+                   1.0e-9
+             : 0.0;
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
@@ -0,0 +1,206 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining an exact floating point sum accumulator.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ExactSum_HPP
+#define RAJA_util_ExactSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Accumulates a sum of doubles exactly, so the result does not
+ *        depend on the order in which values are added or merged.
+ *
+ * The sum is held as a fixed point integer covering the full double range,
+ * split into 32 bit chunks stored in signed 64 bit words. Adding a value
+ * adds its significand to at most three chunks, and carries are only
+ * propagated every 2^30 adds. The result is rounded to double once, in get().
+ * Infinities and NaNs are summed separately as the order does not affect
+ * their sum.
+ */
+class ExactSum
+{
+public:
+  ExactSum() { clear(); }
+
+  explicit ExactSum(double val)
+  {
+    clear();
+    add(val);
+  }
+
+  void clear()
+  {
+    for (int i = 0; i < num_chunks; ++i) {
+      m_chunks[i] = 0;
+    }
+    m_special = 0.0;
+    m_adds_until_normalize = max_adds_between_normalize;
+  }
+
+  void add(double val)
+  {
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(double));
+
+    int exponent = static_cast<int>((bits >> 52) & 0x7ff);
+    uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+
+    if (exponent == 0x7ff) {
+      m_special += val;
+      return;
+    }
+    if (exponent == 0) {
+      if (mantissa == 0) {
+        return;
+      }
+      // subnormal, no implicit leading bit
+      exponent = 1;
+    } else {
+      mantissa |= uint64_t(1) << 52;
+    }
+
+    // bit position of the lowest bit of mantissa in units of 2^-1074
+    const int low = exponent - 1;
+    const int idx = low >> 5;
+    const int shift = low & 31;
+
+    const int64_t p0 = static_cast<int64_t>((mantissa << shift) & chunk_mask);
+    const int64_t p1 = static_cast<int64_t>((mantissa >> (32 - shift)) & chunk_mask);
+    const int64_t p2 = shift ? static_cast<int64_t>(mantissa >> (64 - shift)) : 0;
+
+    if (bits >> 63) {
+      m_chunks[idx] -= p0;
+      m_chunks[idx + 1] -= p1;
+      m_chunks[idx + 2] -= p2;
+    } else {
+      m_chunks[idx] += p0;
+      m_chunks[idx + 1] += p1;
+      m_chunks[idx + 2] += p2;
+    }
+
+    if (--m_adds_until_normalize == 0) {
+      normalize();
+    }
+  }
+
+  void add(ExactSum const& other)
+  {
+    normalize();
+    for (int i = 0; i < num_chunks; ++i) {
+      m_chunks[i] += other.m_chunks[i];
+    }
+    m_special += other.m_special;
+    normalize();
+  }
+
+  //! the sum rounded to the nearest double
+  double get() const
+  {
+    if (m_special != 0.0 || std::isnan(m_special)) {
+      return m_special;
+    }
+
+    ExactSum tmp(*this);
+    tmp.normalize();
+
+    double sign = 1.0;
+    if (tmp.m_chunks[num_chunks - 1] < 0) {
+      sign = -1.0;
+      for (int i = 0; i < num_chunks; ++i) {
+        tmp.m_chunks[i] = -tmp.m_chunks[i];
+      }
+      tmp.normalize();
+    }
+
+    int h = num_chunks - 1;
+    while (h >= 0 && tmp.m_chunks[h] == 0) {
+      --h;
+    }
+    if (h < 0) {
+      return 0.0;
+    }
+
+    uint64_t hi = (tmp.chunk(h) << 32) | tmp.chunk(h - 1);
+    const uint64_t lo = tmp.chunk(h - 2);
+    bool sticky = false;
+    for (int i = h - 3; i >= 0; --i) {
+      sticky = sticky || (tmp.m_chunks[i] != 0);
+    }
+
+    // normalize hi so its top bit is set, pulling in bits from lo
+    int lz = 0;
+    while (!(hi >> 63)) {
+      hi <<= 1;
+      ++lz;
+    }
+    hi |= lo >> (32 - lz);
+    sticky = sticky || ((lo & ((uint64_t(1) << (32 - lz)) - 1)) != 0);
+
+    // round the 64 bit significand to 53 bits, nearest even
+    uint64_t rounded = hi >> 11;
+    const uint64_t rem = hi & 0x7ff;
+    if (rem > 0x400 || (rem == 0x400 && (sticky || (rounded & 1)))) {
+      ++rounded;
+    }
+
+    return sign * std::ldexp(static_cast<double>(rounded),
+                             32 * (h - 1) - lz + 11 - 1074);
+  }
+
+private:
+  // chunks of 32 bits covering bits [0, 2144) in units of 2^-1074, enough
+  // for the largest double plus carries
+  static constexpr int num_chunks = 67;
+  static constexpr uint64_t chunk_mask = 0xffffffff;
+  static constexpr int max_adds_between_normalize = 1 << 30;
+
+  int64_t m_chunks[num_chunks];
+  double m_special;
+  int m_adds_until_normalize;
+
+  uint64_t chunk(int i) const
+  {
+    return (i >= 0) ? static_cast<uint64_t>(m_chunks[i]) : 0;
+  }
+
+  //! propagate carries so all but the top chunk are in [0, 2^32)
+  void normalize()
+  {
+    for (int i = 0; i < num_chunks - 1; ++i) {
+      const int64_t carry = m_chunks[i] >> 32;
+      m_chunks[i] -= carry * (int64_t(1) << 32);
+      m_chunks[i + 1] += carry;
+    }
+    m_adds_until_normalize = max_adds_between_normalize;
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Imbalance_Recorder_HPP
+#define RAJA_Imbalance_Recorder_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+
+namespace RAJA {
+namespace util {
+namespace detail {
+
+/*!
+ * \brief Per-thread busy time and iterations of the OpenMP parallel loops of
+ *        one launch.
+ *
+ * reserve() is called before each parallel region; during the region every
+ * thread only adds to its own slot. Each thread's start and stop times are
+ * kept as well, so plugins can place the shares on a timeline.
+ */
+class ImbalanceRecorder
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  void reserve(int num_threads)
+  {
+    if (num_threads > static_cast<int>(m_threads.size())) {
+      m_threads.resize(num_threads);
+    }
+  }
+
+  void add(int tid,
+           clock::time_point start,
+           clock::time_point stop,
+           std::size_t iterations)
+  {
+    if (tid < 0 || tid >= static_cast<int>(m_threads.size())) return;
+    ThreadLoad& load = m_threads[tid];
+    load.seconds += std::chrono::duration<double>(stop - start).count();
+    load.iterations += iterations;
+    load.spans.push_back(ThreadSpan{tid, start, stop, iterations});
+  }
+
+  //! balance over the threads that took part in at least one region, the
+  //! spans point into this recorder
+  LoadImbalance result()
+  {
+    m_spans.clear();
+    LoadImbalance imbalance;
+    double total_seconds = 0.0;
+    for (const ThreadLoad& load : m_threads) {
+      if (load.spans.empty()) continue;
+      m_spans.insert(m_spans.end(), load.spans.begin(), load.spans.end());
+      if (imbalance.num_threads == 0) {
+        imbalance.min_seconds = imbalance.max_seconds = load.seconds;
+        imbalance.min_iterations = imbalance.max_iterations = load.iterations;
+      }
+      ++imbalance.num_threads;
+      total_seconds += load.seconds;
+      imbalance.min_seconds = std::min(imbalance.min_seconds, load.seconds);
+      imbalance.max_seconds = std::max(imbalance.max_seconds, load.seconds);
+      imbalance.min_iterations =
+          std::min(imbalance.min_iterations, load.iterations);
+      imbalance.max_iterations =
+          std::max(imbalance.max_iterations, load.iterations);
+    }
+    if (imbalance.num_threads > 0) {
+      imbalance.mean_seconds = total_seconds / imbalance.num_threads;
+      imbalance.spans = m_spans.data();
+      imbalance.num_spans = m_spans.size();
+    }
+    return imbalance;
+  }
+
+private:
+  // padded so threads updating neighbouring slots do not share a cache line
+  struct ThreadLoad {
+    double seconds{0.0};
+    std::size_t iterations{0};
+    std::vector<ThreadSpan> spans;
+    char padding[64 - sizeof(double) - sizeof(std::size_t) -
+                 sizeof(std::vector<ThreadSpan>)];
+  };
+
+  std::vector<ThreadLoad> m_threads;
+  std::vector<ThreadSpan> m_spans;
+};
+
+//! recorder of the launch running on this thread, nullptr if not measuring
+inline ImbalanceRecorder*& current_imbalance_recorder()
+{
+  thread_local ImbalanceRecorder* recorder = nullptr;
+  return recorder;
+}
+
+} // closing brace for detail namespace
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
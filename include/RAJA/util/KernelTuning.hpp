@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Kernel_Tuning_HPP
+#define RAJA_Kernel_Tuning_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/util/TuningDatabase.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * Tuned launch parameters of named kernels, kept in tuning_database().
+ *
+ * Entries are keyed by a category, the kernel name, the problem dimensions
+ * and the number of host threads available, so a table tuned on one machine
+ * or thread count is not applied to another. Values are whitespace separated
+ * positive integers, e.g. one tile size per tile_dynamic statement. Tables
+ * are filled offline with tune_parameters() and its wrappers, then read back
+ * through RAJA_TUNING_FILE.
+ */
+
+//! threads available to host kernels, part of every tuning key
+inline int tuning_thread_count()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+inline std::string tuning_key(const char* category,
+                              const char* name,
+                              std::initializer_list<Index_type> dims,
+                              int threads = tuning_thread_count())
+{
+  std::string key = std::string(category) + '\t' + name + '\t';
+  const char* sep = "";
+  for (Index_type dim : dims) {
+    key += sep + std::to_string(dim);
+    sep = " ";
+  }
+  return key + '\t' + std::to_string(threads);
+}
+
+//! read the values stored under key, false unless exactly values.size()
+//! positive values are stored
+inline bool get_tuned_values(const std::string& key,
+                             std::vector<Index_type>& values)
+{
+  std::string stored;
+  if (!tuning_database().get(key, stored)) return false;
+
+  std::istringstream in(stored);
+  std::vector<Index_type> parsed;
+  Index_type value;
+  while (in >> value) {
+    if (value <= 0) return false;
+    parsed.push_back(value);
+  }
+  if (!in.eof() || parsed.size() != values.size()) return false;
+
+  values = parsed;
+  return true;
+}
+
+inline void set_tuned_values(const std::string& key,
+                             const std::vector<Index_type>& values)
+{
+  std::string stored;
+  const char* sep = "";
+  for (Index_type value : values) {
+    stored += sep + std::to_string(value);
+    sep = " ";
+  }
+  tuning_database().set(key, stored);
+}
+
+/*!
+ * \brief Tile sizes for the tile_dynamic statements of kernel name.
+ *
+ * Returns the sizes tuned for the problem dimensions dims and the current
+ * thread count, or defaults if there are none. For example
+ *
+ *   auto t = RAJA::util::tuned_tile_sizes("transpose", {N, M}, {16, 16});
+ *   RAJA::kernel_param<POL>(segs,
+ *       RAJA::make_tuple(RAJA::TileSize{t[0]}, RAJA::TileSize{t[1]}), body);
+ */
+template <std::size_t N>
+std::array<Index_type, N> tuned_tile_sizes(const char* name,
+                                           std::initializer_list<Index_type> dims,
+                                           const Index_type (&defaults)[N])
+{
+  std::vector<Index_type> values(N);
+  const bool tuned = get_tuned_values(tuning_key("tile", name, dims), values);
+
+  std::array<Index_type, N> sizes;
+  for (std::size_t i = 0; i < N; ++i) {
+    sizes[i] = tuned ? values[i] : defaults[i];
+  }
+  return sizes;
+}
+
+/*!
+ * \brief Offline search driver filling one table entry.
+ *
+ * Calls run(candidate) trials times for every candidate, stores the
+ * candidate with the shortest single run under key and returns its index.
+ * run must execute the kernel with the given parameters and wait for it.
+ */
+template <typename Run>
+std::size_t tune_parameters(const std::string& key,
+                            const std::vector<std::vector<Index_type>>& candidates,
+                            Run&& run,
+                            int trials = 3)
+{
+  using clock = std::chrono::steady_clock;
+
+  std::size_t best = 0;
+  double best_seconds = 0.0;
+  for (std::size_t c = 0; c < candidates.size(); ++c) {
+    for (int t = 0; t < trials; ++t) {
+      const clock::time_point start = clock::now();
+      run(candidates[c]);
+      const double seconds =
+          std::chrono::duration<double>(clock::now() - start).count();
+      if ((c == 0 && t == 0) || seconds < best_seconds) {
+        best = c;
+        best_seconds = seconds;
+      }
+    }
+  }
+  if (!candidates.empty()) {
+    set_tuned_values(key, candidates[best]);
+  }
+  return best;
+}
+
+//! search the tile sizes of kernel name, see tuned_tile_sizes()
+template <std::size_t N, typename Run>
+std::array<Index_type, N> tune_tile_sizes(
+    const char* name,
+    std::initializer_list<Index_type> dims,
+    const std::vector<std::array<Index_type, N>>& candidates,
+    Run&& run,
+    int trials = 3)
+{
+  std::vector<std::vector<Index_type>> values;
+  for (const auto& candidate : candidates) {
+    values.emplace_back(candidate.begin(), candidate.end());
+  }
+  const std::size_t best = tune_parameters(
+      tuning_key("tile", name, dims), values,
+      [&](const std::vector<Index_type>& sizes) {
+        std::array<Index_type, N> tile;
+        for (std::size_t i = 0; i < N; ++i) tile[i] = sizes[i];
+        run(tile);
+      },
+      trials);
+  return candidates.empty() ? std::array<Index_type, N>{} : candidates[best];
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
@@ -118,9 +118,35 @@ struct AtomicTypedLocalArray<AtomicPolicy, DataType, camp::idx_seq<Perm ...>,
   RAJA_INLINE void set_data(DataType * data_ptr){
     m_arrayPtr = data_ptr;
   }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE DataType * get_data() const {
+    return m_arrayPtr;
+  }
 };
 
 
+namespace internal {
+
+  //! true for local array types, which InitLocalMem gives storage to
+  template<typename T>
+  struct is_local_array : std::false_type {};
+
+  template<typename ValueType, typename IdxLin, typename Range,
+           typename Sizes, typename Strides, typename IndexTypes>
+  struct is_local_array<TypedViewBase<ValueType, ValueType *,
+      RAJA::detail::StaticLayoutBase_impl<IdxLin, Range, Sizes, Strides>,
+      IndexTypes>> : std::true_type {};
+
+  template<typename AtomicPolicy, typename DataType, typename Perm,
+           typename Sizes, typename ... IndexTypes>
+  struct is_local_array<AtomicTypedLocalArray<AtomicPolicy, DataType, Perm,
+                                              Sizes, IndexTypes...>>
+      : std::true_type {};
+
+}
+
+
 
 
 
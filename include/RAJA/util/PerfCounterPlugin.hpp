@@ -0,0 +1,437 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Perf_Counter_Plugin_HPP
+#define RAJA_Perf_Counter_Plugin_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * \brief Plugin reading Linux hardware performance counters around each
+ *        kernel launch.
+ *
+ * A counter group (instructions, cycles, last level cache misses, and
+ * optionally a raw floating point event) is opened for every thread of the
+ * process, so the work of OpenMP and TBB threads is attributed to the kernel
+ * that launched it. The threads of the process are only listed again when
+ * their number changed since the last launch. Counts are aggregated per
+ * kernel and reported as IPC, cache misses per iteration and an estimate of
+ * the memory bandwidth from the cache misses. Launches running at the same
+ * time on different threads see each other's counts.
+ *
+ * When the kernel multiplexes the counters with other events, the counts
+ * are scaled by the fraction of time the group was counting and the kernel
+ * is marked as scaled in the report.
+ *
+ * When counters can not be opened, e.g. in containers or with a restrictive
+ * perf_event_paranoid setting, available() is false and the plugin does
+ * nothing. Settings are read through PluginOptions:
+ *
+ *   RAJA_PERF_COUNTERS_OUTPUT     csv report file, standard output if unset
+ *   RAJA_PERF_COUNTERS_FLOP_EVENT raw event code counting floating point
+ *                                 operations, e.g. 0x01c7 on some x86 cpus
+ */
+class PerfCounterPlugin : public PluginStrategy
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  enum Counter : int {
+    instructions,
+    cycles,
+    cache_misses,
+    flops,
+    num_counters
+  };
+
+  struct Counts {
+    std::uint64_t value[num_counters] = {};
+    //! true if any of the counts were scaled for multiplexing
+    bool scaled{false};
+
+    Counts& operator+=(const Counts& other)
+    {
+      for (int c = 0; c < num_counters; ++c) value[c] += other.value[c];
+      scaled = scaled || other.scaled;
+      return *this;
+    }
+
+    //! counts of threads that exited in between are lost, never wrap
+    Counts operator-(const Counts& other) const
+    {
+      Counts diff;
+      for (int c = 0; c < num_counters; ++c) {
+        diff.value[c] =
+            value[c] > other.value[c] ? value[c] - other.value[c] : 0;
+      }
+      diff.scaled = scaled || other.scaled;
+      return diff;
+    }
+  };
+
+  struct KernelStats {
+    std::string name;
+    std::string policy;
+    std::string pattern;
+    std::size_t launches{0};
+    double seconds{0.0};
+    double iterations{0.0};
+    Counts counts{};
+  };
+
+  PerfCounterPlugin() { configure(make_options("")); }
+
+  PerfCounterPlugin(const PerfCounterPlugin&) = delete;
+  PerfCounterPlugin& operator=(const PerfCounterPlugin&) = delete;
+
+  ~PerfCounterPlugin() override
+  {
+    if (!m_stats.empty()) {
+      finalize();
+    }
+    close_groups();
+  }
+
+  //! false if hardware counters could not be opened
+  bool available() const { return m_available; }
+
+  //! true if the floating point event was configured and opened for every
+  //! thread
+  bool counts_flops() const
+  {
+    return m_flop_event_set && !m_flop_event_failed && m_available;
+  }
+
+  void init(const PluginOptions& p) override { configure(p); }
+
+  void preLaunch(const PluginContext& RAJA_UNUSED_ARG(p)) override
+  {
+    if (!m_available) return;
+
+    Launch launch;
+    {
+      // pick up threads started since the last launch, e.g. by OpenMP
+      const long tasks = task_count();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (tasks != m_task_count) {
+        m_task_count = tasks;
+        open_new_threads();
+      }
+      launch.counts = read_all();
+    }
+    launch.start = clock::now();
+    launches().emplace_back(this, launch);
+  }
+
+  void postLaunch(const PluginContext& p) override
+  {
+    if (!m_available) return;
+
+    const clock::time_point stop = clock::now();
+
+    auto& stack = launches();
+    auto it = std::find_if(stack.rbegin(), stack.rend(),
+                           [this](const std::pair<const PerfCounterPlugin*,
+                                                  Launch>& l) {
+                             return l.first == this;
+                           });
+    if (it == stack.rend()) return;
+
+    const Launch launch = it->second;
+    stack.erase(std::next(it).base());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Counts end = read_all();
+
+    const char* name = p.kernel_name ? p.kernel_name : "";
+    const char* policy = p.policy_name ? p.policy_name : "";
+    std::string key = std::string(pattern_name(p.pattern)) + '\n' + name +
+                      '\n' + policy;
+
+    KernelStats& stats = m_stats[std::move(key)];
+    if (stats.launches == 0) {
+      stats.name = name;
+      stats.policy = policy;
+      stats.pattern = pattern_name(p.pattern);
+    }
+    ++stats.launches;
+    stats.seconds +=
+        std::chrono::duration<double>(stop - launch.start).count();
+    stats.iterations += static_cast<double>(p.num_iterations);
+    stats.counts += end - launch.counts;
+  }
+
+  void finalize() override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_output.empty()) {
+      write_report(std::cout);
+    } else {
+      std::ofstream out(m_output);
+      if (out) {
+        write_report(out);
+      } else {
+        std::fprintf(stderr, "[PerfCounterPlugin]: could not open %s\n",
+                     m_output.c_str());
+      }
+    }
+    m_stats.clear();
+  }
+
+  //! write the counts collected so far as csv
+  void write_report(std::ostream& out) const
+  {
+    out << "pattern,kernel,policy,launches,seconds,instructions,cycles,ipc,"
+           "llc_misses,llc_misses_per_iteration,flops,est_bandwidth_gb_s,"
+           "scaled\n";
+    for (const auto& entry : m_stats) {
+      const KernelStats& s = entry.second;
+      const Counts& c = s.counts;
+      const double ipc =
+          c.value[cycles] ? double(c.value[instructions]) / c.value[cycles]
+                          : 0.0;
+      const double misses_per_it =
+          s.iterations > 0.0 ? double(c.value[cache_misses]) / s.iterations
+                             : 0.0;
+      const double bandwidth =
+          s.seconds > 0.0 ? double(c.value[cache_misses]) * m_line_size /
+                                s.seconds * 1.0e-9
+                          : 0.0;
+      out << s.pattern << ',' << detail::csv_quote(s.name) << ','
+          << detail::csv_quote(s.policy) << ',' << s.launches << ','
+          << s.seconds << ',' << c.value[instructions] << ','
+          << c.value[cycles] << ',' << ipc << ',' << c.value[cache_misses]
+          << ',' << misses_per_it << ',';
+      if (counts_flops()) {
+        out << c.value[flops];
+      }
+      out << ',' << bandwidth << ',' << (c.scaled ? 1 : 0) << '\n';
+    }
+  }
+
+private:
+  struct Launch {
+    Counts counts;
+    clock::time_point start;
+  };
+
+  struct Group {
+    int fd[num_counters];
+  };
+
+  // launches in flight on this thread, innermost last
+  static std::vector<std::pair<const PerfCounterPlugin*, Launch>>& launches()
+  {
+    thread_local std::vector<std::pair<const PerfCounterPlugin*, Launch>>
+        stack;
+    return stack;
+  }
+
+  void configure(const PluginOptions& p)
+  {
+    m_output = p.get("RAJA_PERF_COUNTERS_OUTPUT");
+
+    const std::string flop_event = p.get("RAJA_PERF_COUNTERS_FLOP_EVENT");
+    m_flop_event_set = !flop_event.empty();
+    m_flop_event = std::strtoull(flop_event.c_str(), nullptr, 0);
+
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_LINESIZE)
+    const long line = sysconf(_SC_LEVEL3_CACHE_LINESIZE);
+    m_line_size = line > 0 ? static_cast<double>(line) : 64.0;
+#endif
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    close_groups();
+    m_flop_event_failed = false;
+    m_task_count = task_count();
+    open_new_threads();
+    m_available = has_groups();
+  }
+
+#if defined(__linux__)
+  static int open_counter(pid_t tid, std::uint32_t type, std::uint64_t config,
+                          int group_fd)
+  {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, tid, -1, group_fd, 0));
+  }
+
+  //! open a counter group for tid, nothing is opened if the leader fails
+  void open_group(pid_t tid)
+  {
+    Group group;
+
+    group.fd[instructions] = open_counter(
+        tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1);
+    if (group.fd[instructions] < 0) {
+      if (m_threads.empty() && !m_reported_error) {
+        std::fprintf(stderr,
+                     "[PerfCounterPlugin]: hardware counters unavailable: %s\n",
+                     std::strerror(errno));
+        m_reported_error = true;
+      }
+      return;
+    }
+    const int leader = group.fd[instructions];
+    group.fd[cycles] =
+        open_counter(tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, leader);
+    group.fd[cache_misses] = open_counter(
+        tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, leader);
+    group.fd[flops] = m_flop_event_set
+                          ? open_counter(tid, PERF_TYPE_RAW, m_flop_event,
+                                         leader)
+                          : -1;
+    if (m_flop_event_set && group.fd[flops] < 0 && !m_flop_event_failed) {
+      std::fprintf(stderr,
+                   "[PerfCounterPlugin]: floating point event unavailable: "
+                   "%s\n",
+                   std::strerror(errno));
+      m_flop_event_failed = true;
+    }
+    m_threads[tid] = group;
+  }
+
+  //! number of links of the task directory, which changes with the number
+  //! of threads of the process
+  static long task_count()
+  {
+    struct stat st;
+    if (stat("/proc/self/task", &st) != 0) return -1;
+    return static_cast<long>(st.st_nlink);
+  }
+
+  //! open groups for threads created since the last call
+  void open_new_threads()
+  {
+    DIR* dir = opendir("/proc/self/task");
+    if (dir == nullptr) return;
+
+    while (struct dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] == '.') continue;
+      const pid_t tid = static_cast<pid_t>(std::atoi(entry->d_name));
+      if (m_threads.count(tid) == 0) {
+        open_group(tid);
+      }
+    }
+    closedir(dir);
+  }
+
+  bool has_groups() const { return !m_threads.empty(); }
+
+  Counts read_all() const
+  {
+    Counts total;
+    for (const auto& entry : m_threads) {
+      const Group& group = entry.second;
+      // number of members, time enabled, time running, then the values
+      std::uint64_t buf[3 + num_counters];
+      const ssize_t bytes = read(group.fd[instructions], buf, sizeof(buf));
+      // the thread exited, its counts are gone
+      if (bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t))) continue;
+
+      // the group only counted for part of the time it was enabled when it
+      // shared the hardware counters with other events
+      const std::uint64_t enabled = buf[1];
+      const std::uint64_t running = buf[2];
+      const bool scaled = running < enabled;
+      const double scale =
+          running > 0 && scaled ? double(enabled) / double(running) : 1.0;
+      total.scaled = total.scaled || scaled;
+
+
+      // a group read returns the open members in the order they were opened
+      int member = 0;
+      for (int c = 0; c < num_counters; ++c) {
+        if (group.fd[c] >= 0 && static_cast<std::uint64_t>(member) < buf[0]) {
+          total.value[c] += static_cast<std::uint64_t>(
+              double(buf[3 + member]) * scale);
+          ++member;
+        }
+      }
+    }
+    return total;
+  }
+
+  void close_groups()
+  {
+    for (auto& entry : m_threads) {
+      for (int c = num_counters - 1; c >= 0; --c) {
+        if (entry.second.fd[c] >= 0) close(entry.second.fd[c]);
+      }
+    }
+    m_threads.clear();
+  }
+
+  std::map<pid_t, Group> m_threads;
+  bool m_reported_error{false};
+#else
+  static long task_count() { return -1; }
+
+  void open_new_threads() {}
+
+  bool has_groups() const { return false; }
+
+  Counts read_all() const { return Counts{}; }
+
+  void close_groups() {}
+#endif
+
+  std::string m_output;
+  bool m_flop_event_set{false};
+  bool m_flop_event_failed{false};
+  std::uint64_t m_flop_event{0};
+  double m_line_size{64.0};
+  bool m_available{false};
+
+  std::mutex m_mutex;
+  long m_task_count{-1};
+  std::map<std::string, KernelStats> m_stats;
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
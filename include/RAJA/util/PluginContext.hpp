@@ -8,34 +8,318 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
+//
+// Compilers providing __builtin_FILE and friends evaluate them at the call
+// site when used as default arguments, which is how KernelName records
+// where a kernel was launched from.
+//
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_FILE) && __has_builtin(__builtin_LINE) && \
+    __has_builtin(__builtin_FUNCTION)
+#define RAJA_HAS_BUILTIN_SOURCE_LOCATION
+#endif
+#elif defined(__GNUC__) && !defined(__clang__)
+#define RAJA_HAS_BUILTIN_SOURCE_LOCATION
+#elif defined(_MSC_VER) && _MSC_VER >= 1926
+#define RAJA_HAS_BUILTIN_SOURCE_LOCATION
+#endif
+
 namespace RAJA {
 namespace util {
 
 class KokkosPluginLoader;
 
+/*!
+ * \brief Location in the user's source code a kernel was launched from.
+ *
+ * file and function are nullptr when the location is not known.
+ */
+struct SourceLocation {
+  const char* file{nullptr};
+  const char* function{nullptr};
+  int line{0};
+};
+
+/*!
+ * \brief Estimated memory traffic and floating point work of one iteration
+ *        of a kernel, used for roofline reports; zero when not given.
+ */
+struct WorkEstimate {
+  double bytes_per_iteration{0.0};
+  double flops_per_iteration{0.0};
+
+  bool empty() const
+  {
+    return bytes_per_iteration <= 0.0 && flops_per_iteration <= 0.0;
+  }
+
+  //! flops per byte moved, 0 if no bytes are given
+  double arithmetic_intensity() const
+  {
+    return bytes_per_iteration > 0.0
+               ? flops_per_iteration / bytes_per_iteration
+               : 0.0;
+  }
+};
+
+/*!
+ * \brief Optional name attached to a kernel, passed ahead of the iteration
+ *        space to forall, kernel, and WorkGroup::run, and to a Grid for
+ *        launch.
+ *
+ * The name is reported to plugins through PluginContext together with the
+ * source location the KernelName was constructed at. The name is not copied
+ * so it must outlive the kernel, a string literal is the usual choice.
+ * with_work() adds the bytes and flops of one iteration, which profiling
+ * plugins turn into achieved bandwidth and flop rates.
+ *
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(
+ *       RAJA::KernelName("daxpy").with_work(24, 2),
+ *       RAJA::RangeSegment(0, N),
+ *       [=](int i) { y[i] += a * x[i]; });
+ */
+struct KernelName {
+  const char* name{nullptr};
+  SourceLocation location{};
+  WorkEstimate work{};
+
+  KernelName() = default;
+
+#if defined(RAJA_HAS_BUILTIN_SOURCE_LOCATION)
+  explicit KernelName(const char* in_name,
+                      const char* file = __builtin_FILE(),
+                      const char* function = __builtin_FUNCTION(),
+                      int line = __builtin_LINE())
+      : name{in_name}, location{file, function, line}
+  {
+  }
+#else
+  explicit KernelName(const char* in_name) : name{in_name} {}
+#endif
+
+  KernelName(const char* in_name, SourceLocation in_location)
+      : name{in_name}, location{in_location}
+  {
+  }
+
+  KernelName(const char* in_name,
+             SourceLocation in_location,
+             WorkEstimate in_work)
+      : name{in_name}, location{in_location}, work{in_work}
+  {
+  }
+
+  //! estimated bytes moved and flops executed by each iteration
+  KernelName& with_work(double bytes_per_iteration, double flops_per_iteration)
+  {
+    work.bytes_per_iteration = bytes_per_iteration;
+    work.flops_per_iteration = flops_per_iteration;
+    return *this;
+  }
+};
+
+/*!
+ * \brief Top-level pattern that invoked a plugin callback.
+ */
+enum class PluginPattern {
+  undefined,
+  forall,
+  kernel,
+  launch,
+  workgroup,
+  scan,
+  sort,
+  reduce
+};
+
+//! lower case name of pattern, as used in plugin reports
+inline const char* pattern_name(PluginPattern pattern)
+{
+  switch (pattern) {
+    case PluginPattern::forall: return "forall";
+    case PluginPattern::kernel: return "kernel";
+    case PluginPattern::launch: return "launch";
+    case PluginPattern::workgroup: return "workgroup";
+    case PluginPattern::scan: return "scan";
+    case PluginPattern::sort: return "sort";
+    case PluginPattern::reduce: return "reduce";
+    default: return "undefined";
+  }
+}
+
+/*!
+ * \brief One thread's share of one OpenMP parallel loop of a launch.
+ */
+struct ThreadSpan {
+  int thread{0};
+  std::chrono::steady_clock::time_point start{};
+  std::chrono::steady_clock::time_point stop{};
+  std::size_t iterations{0};
+};
+
+/*!
+ * \brief Load balance across the threads of the OpenMP parallel loops run by
+ *        a launch.
+ *
+ * Only measured when RAJA is configured with RAJA_ENABLE_OPENMP_IMBALANCE;
+ * num_threads is 0 for launches that were not measured. Times and
+ * iterations are summed per thread over all parallel loops of the launch.
+ */
+struct LoadImbalance {
+  int num_threads{0};
+  double min_seconds{0.0};
+  double max_seconds{0.0};
+  double mean_seconds{0.0};
+  std::size_t min_iterations{0};
+  std::size_t max_iterations{0};
+
+  //! every thread's share of every parallel loop, ordered by thread; owned
+  //! by the launch and only valid during postLaunch
+  const ThreadSpan* spans{nullptr};
+  std::size_t num_spans{0};
+
+  //! busiest thread time over mean thread time, 1 when perfectly balanced
+  double max_over_mean() const
+  {
+    return mean_seconds > 0.0 ? max_seconds / mean_seconds : 1.0;
+  }
+
+  //! fraction of the threads' time spent waiting for the busiest thread
+  double idle_fraction() const
+  {
+    return max_seconds > 0.0 ? 1.0 - mean_seconds / max_seconds : 0.0;
+  }
+};
+
 struct PluginContext {
   public:
     PluginContext(const Platform p) :
       platform(p) {}
 
+    PluginContext(const Platform p,
+                  const PluginPattern in_pattern,
+                  const char* in_policy_name,
+                  const KernelName& name,
+                  std::size_t in_num_iterations) :
+      platform(p),
+      pattern(in_pattern),
+      kernel_name(name.name),
+      policy_name(in_policy_name),
+      num_iterations(in_num_iterations),
+      location(name.location),
+      work(name.work) {}
+
     Platform platform;
 
+    //! pattern the callback comes from
+    PluginPattern pattern{PluginPattern::undefined};
+
+    //! name given with KernelName, nullptr if the kernel is unnamed
+    const char* kernel_name{nullptr};
+
+    //! name of the execution policy type
+    const char* policy_name{nullptr};
+
+    //! size of the iteration space, 0 if it is not known
+    std::size_t num_iterations{0};
+
+    //! call site recorded by KernelName
+    SourceLocation location{};
+
+    //! per-iteration work given with KernelName::with_work
+    WorkEstimate work{};
+
+    //! per-thread balance of the launch, only set in postLaunch
+    LoadImbalance imbalance{};
+
   private:
     mutable uint64_t kID;
 
     friend class KokkosPluginLoader;
 };
 
+namespace detail {
+
+template<typename T>
+const char* raw_type_name()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+// extract T from the signature of raw_type_name<T>
+inline std::string type_name_from_signature(const std::string& sig)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  const std::string prefix = "raw_type_name<";
+  const std::size_t begin = sig.find(prefix);
+  const std::size_t end = sig.rfind(">(void)");
+#else
+  const std::string prefix = "T = ";
+  const std::size_t begin = sig.find(prefix);
+  std::size_t end = sig.find(';', begin);
+  if (end == std::string::npos) {
+    end = sig.rfind(']');
+  }
+#endif
+  if (begin == std::string::npos || end == std::string::npos ||
+      end < begin + prefix.size()) {
+    return sig;
+  }
+  return sig.substr(begin + prefix.size(), end - begin - prefix.size());
+}
+
+} // closing brace for detail namespace
+
+/*!
+ * \brief Human readable name of type T, computed once per type.
+ */
+template<typename T>
+const char* type_name()
+{
+  static const std::string name =
+      detail::type_name_from_signature(detail::raw_type_name<T>());
+  return name.c_str();
+}
+
 template<typename Policy>
-PluginContext make_context()
+PluginContext make_context(PluginPattern pattern,
+                           const KernelName& name,
+                           std::size_t num_iterations)
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  return PluginContext{RAJA::detail::get_platform<Policy>::value,
+                       pattern,
+#if defined(RAJA_ENABLE_PLUGINS)
+                       type_name<Policy>(),
+#else
+                       nullptr,
+#endif
+                       name,
+                       num_iterations};
+}
+
+template<typename Policy>
+PluginContext make_context(PluginPattern pattern = PluginPattern::undefined,
+                           std::size_t num_iterations = 0)
+{
+  return make_context<Policy>(pattern, KernelName{}, num_iterations);
 }
 
 } // closing brace for util namespace
+
+using util::KernelName;
+
 } // closing brace for RAJA namespace
 
 #endif
@@ -8,6 +8,7 @@
 #ifndef RAJA_Plugin_Options_HPP
 #define RAJA_Plugin_Options_HPP
 
+#include <cstdlib>
 #include <string>
 
 namespace RAJA {
@@ -16,7 +17,15 @@ namespace util {
 struct PluginOptions
 {
     PluginOptions(const std::string& newstr) : str(newstr) {};
-    
+
+    //! value of setting name from the environment, default_value if unset
+    std::string get(const std::string& name,
+                    const std::string& default_value = "") const
+    {
+      const char* env = std::getenv(name.c_str());
+      return env ? std::string(env) : default_value;
+    }
+
     std::string str;
 };
 
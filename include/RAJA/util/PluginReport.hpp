@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Plugin_Report_HPP
+#define RAJA_Plugin_Report_HPP
+
+#include <cstdio>
+#include <string>
+
+namespace RAJA {
+namespace util {
+namespace detail {
+
+//! str as a quoted csv field
+inline std::string csv_quote(const std::string& str)
+{
+  std::string quoted = "\"";
+  for (char c : str) {
+    if (c == '"') quoted += '"';
+    quoted += c;
+  }
+  return quoted + '"';
+}
+
+//! str as a json string literal
+inline std::string json_quote(const std::string& str)
+{
+  std::string quoted = "\"";
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+      quoted += buf;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + '"';
+}
+
+//! true if str ends with suffix
+inline bool ends_with(const std::string& str, const std::string& suffix)
+{
+  return str.size() >= suffix.size() &&
+         str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // closing brace for detail namespace
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
@@ -37,6 +37,15 @@ class PluginStrategy
 
 using PluginRegistry = Registry<PluginStrategy>;
 
+namespace detail {
+
+//! set when the first plugin is created, until then launches skip the
+//! registry entirely
+extern RAJASHAREDDLL_API bool plugins_created;
+
+} // closing brace for detail namespace
+
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
@@ -0,0 +1,422 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Profiler_Plugin_HPP
+#define RAJA_Profiler_Plugin_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/BandwidthProbe.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * \brief Plugin collecting per-kernel timing statistics, reported when
+ *        plugins are finalized or the plugin is destroyed.
+ *
+ * Kernels are identified by pattern, name, policy and call site. Every call
+ * is counted, but only one in RAJA_PROFILER_SAMPLE_RATE calls of each kernel
+ * is timed to bound the overhead on short kernels; the total time is
+ * estimated from the samples.
+ *
+ * Kernels named with KernelName::with_work also get their achieved GB/s and
+ * GFLOP/s, and the fraction of the roofline bound they reach: the peak
+ * bandwidth times their arithmetic intensity, capped by the peak flop rate
+ * if one is given. Unless it is set, the peak bandwidth is measured with a
+ * STREAM triad when finalize() is called with such kernels; reports written
+ * when the plugin is destroyed, possibly during static destruction, never
+ * run the probe and leave the fractions at 0. The settings are read through
+ * PluginOptions:
+ *
+ *   RAJA_PROFILER_SAMPLE_RATE  time 1 in N calls of a kernel, default 1
+ *   RAJA_PROFILER_OUTPUT       report file, standard output if unset
+ *   RAJA_PROFILER_FORMAT       csv or json, by default json if the output
+ *                              file ends in .json and csv otherwise
+ *   RAJA_PROFILER_PEAK_GBS     peak memory bandwidth, measured if unset
+ *   RAJA_PROFILER_PEAK_GFLOPS  peak flop rate, no compute roof if unset
+ *   RAJA_PROFILER_PROBE_SIZE   doubles per array of the bandwidth probe,
+ *                              default 8388608
+ */
+class ProfilerPlugin : public PluginStrategy
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  //! number of durations kept per kernel to estimate percentiles
+  static constexpr std::size_t reservoir_size = 1024;
+
+  struct KernelStats {
+    std::string name;
+    std::string policy;
+    std::string pattern;
+    std::string file;
+    int line{0};
+
+    std::size_t calls{0};
+    std::size_t samples{0};
+    double total_seconds{0.0};
+    double min_seconds{0.0};
+    double max_seconds{0.0};
+    double total_iterations{0.0};
+    WorkEstimate work{};
+
+    std::vector<double> reservoir;
+    std::uint64_t rng_state{0x9e3779b97f4a7c15ull};
+
+    void add(double seconds, std::size_t iterations)
+    {
+      min_seconds = samples ? std::min(min_seconds, seconds) : seconds;
+      max_seconds = samples ? std::max(max_seconds, seconds) : seconds;
+      ++samples;
+      total_seconds += seconds;
+      total_iterations += static_cast<double>(iterations);
+
+      // reservoir sampling keeps a uniform subset of all samples
+      if (reservoir.size() < reservoir_size) {
+        reservoir.push_back(seconds);
+      } else {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 7;
+        rng_state ^= rng_state << 17;
+        const std::size_t slot = static_cast<std::size_t>(rng_state % samples);
+        if (slot < reservoir_size) {
+          reservoir[slot] = seconds;
+        }
+      }
+    }
+
+    //! total time of all calls, estimated from the sampled ones
+    double estimated_total_seconds() const
+    {
+      return samples ? total_seconds * static_cast<double>(calls) /
+                           static_cast<double>(samples)
+                     : 0.0;
+    }
+
+    double gb_per_s() const
+    {
+      return total_seconds > 0.0 ? total_iterations *
+                                       work.bytes_per_iteration /
+                                       total_seconds * 1.0e-9
+                                 : 0.0;
+    }
+
+    double gflop_per_s() const
+    {
+      return total_seconds > 0.0 ? total_iterations *
+                                       work.flops_per_iteration /
+                                       total_seconds * 1.0e-9
+                                 : 0.0;
+    }
+
+    //! duration below which a fraction p of the sampled launches finished
+    double percentile(double p) const
+    {
+      if (reservoir.empty()) return 0.0;
+      std::vector<double> sorted(reservoir);
+      const std::size_t idx = static_cast<std::size_t>(
+          p * static_cast<double>(sorted.size() - 1) + 0.5);
+      std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+      return sorted[idx];
+    }
+  };
+
+  ProfilerPlugin() { configure(make_options("")); }
+
+  ProfilerPlugin(const ProfilerPlugin&) = delete;
+  ProfilerPlugin& operator=(const ProfilerPlugin&) = delete;
+
+  ~ProfilerPlugin() override
+  {
+    // programs often never call finalize_plugins, report what we have
+    if (!m_stats.empty()) {
+      report(false);
+    }
+  }
+
+  void init(const PluginOptions& p) override { configure(p); }
+
+  void preLaunch(const PluginContext& p) override
+  {
+    KernelStats* stats = nullptr;
+    std::size_t generation = 0;
+    bool sampled = false;
+    {
+      std::string key = make_key(p);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_stats.find(key);
+      if (it == m_stats.end()) {
+        it = m_stats.emplace(std::move(key), make_stats(p)).first;
+      }
+      stats = &it->second;
+      generation = m_generation;
+      // sample each kernel on its own count so interleaved kernels do not
+      // alias with the sample rate
+      sampled = (stats->calls++ % m_sample_rate == 0);
+    }
+    launches().emplace_back(
+        this, Launch{stats, generation, sampled, clock::time_point{}});
+    if (sampled) {
+      launches().back().second.start = clock::now();
+    }
+  }
+
+  void postLaunch(const PluginContext& p) override
+  {
+    const clock::time_point stop = clock::now();
+
+    auto& stack = launches();
+    auto it = std::find_if(stack.rbegin(), stack.rend(),
+                           [this](const std::pair<const ProfilerPlugin*,
+                                                  Launch>& l) {
+                             return l.first == this;
+                           });
+    if (it == stack.rend()) return;
+
+    const Launch launch = it->second;
+    stack.erase(std::next(it).base());
+    if (!launch.sampled) return;
+
+    const double seconds =
+        std::chrono::duration<double>(stop - launch.start).count();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the statistics were reported and cleared while the kernel ran
+    if (launch.generation != m_generation) return;
+    launch.stats->add(seconds, p.num_iterations);
+  }
+
+  //! write the report, measuring the peak bandwidth first if it is needed
+  void finalize() override { report(true); }
+
+  std::size_t sample_rate() const { return m_sample_rate; }
+
+  //! time one in rate calls of each kernel, 0 is treated as 1
+  void set_sample_rate(std::size_t rate)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sample_rate = rate > 0 ? rate : 1;
+  }
+
+  //! write reports to file as json or csv, standard output if file is empty
+  void set_output(const std::string& file, bool json)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_output = file;
+    m_json = json;
+  }
+
+  std::size_t probe_size() const { return m_probe_size; }
+
+  //! doubles per array of the bandwidth probe, 0 keeps the current size
+  void set_probe_size(std::size_t num_elements)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (num_elements > 0) m_probe_size = num_elements;
+  }
+
+  //! peak memory bandwidth in GB/s, 0 until set or measured
+  double peak_gb_per_s() const { return m_peak_gbs; }
+
+  //! set the roofs instead of measuring, 0 leaves a roof unknown
+  void set_peak(double gb_per_s, double gflop_per_s)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_peak_gbs = gb_per_s;
+    m_peak_gflops = gflop_per_s;
+  }
+
+  //! achieved fraction of the roofline bound of kernel s, 0 if unknown
+  double roofline_fraction(const KernelStats& s) const
+  {
+    const bool has_bytes = s.work.bytes_per_iteration > 0.0;
+    if (s.work.flops_per_iteration <= 0.0) {
+      // pure data movement, compare with the bandwidth roof only
+      return m_peak_gbs > 0.0 && has_bytes ? s.gb_per_s() / m_peak_gbs : 0.0;
+    }
+
+    double bound = m_peak_gflops;
+    if (m_peak_gbs > 0.0 && has_bytes) {
+      const double memory_bound = m_peak_gbs * s.work.arithmetic_intensity();
+      bound = bound > 0.0 ? std::min(bound, memory_bound) : memory_bound;
+    }
+    return bound > 0.0 ? s.gflop_per_s() / bound : 0.0;
+  }
+
+  //! write the statistics collected so far as csv or json
+  void write_report(std::ostream& out, bool json) const
+  {
+    const char* sep = "";
+    if (json) {
+      out << "{\"sample_rate\": " << m_sample_rate
+          << ", \"peak_gb_per_s\": " << m_peak_gbs
+          << ", \"peak_gflop_per_s\": " << m_peak_gflops << ", \"kernels\": [";
+    } else {
+      out << "pattern,kernel,policy,file,line,calls,samples,total_s,mean_s,"
+             "min_s,max_s,p50_s,p90_s,p99_s,iterations_per_s,bytes_per_it,"
+             "flops_per_it,gb_per_s,gflop_per_s,roofline_fraction\n";
+    }
+    for (const auto& entry : m_stats) {
+      const KernelStats& s = entry.second;
+      if (s.samples == 0) continue;
+      const double mean = s.total_seconds / static_cast<double>(s.samples);
+      const double its_per_s =
+          s.total_seconds > 0.0 ? s.total_iterations / s.total_seconds : 0.0;
+      if (json) {
+        out << sep << "\n  {\"pattern\": " << detail::json_quote(s.pattern)
+            << ", \"kernel\": " << detail::json_quote(s.name)
+            << ", \"policy\": " << detail::json_quote(s.policy)
+            << ", \"file\": " << detail::json_quote(s.file)
+            << ", \"line\": " << s.line
+            << ", \"calls\": " << s.calls
+            << ", \"samples\": " << s.samples
+            << ", \"total_s\": " << s.estimated_total_seconds()
+            << ", \"mean_s\": " << mean
+            << ", \"min_s\": " << s.min_seconds
+            << ", \"max_s\": " << s.max_seconds
+            << ", \"p50_s\": " << s.percentile(0.5)
+            << ", \"p90_s\": " << s.percentile(0.9)
+            << ", \"p99_s\": " << s.percentile(0.99)
+            << ", \"iterations_per_s\": " << its_per_s
+            << ", \"bytes_per_it\": " << s.work.bytes_per_iteration
+            << ", \"flops_per_it\": " << s.work.flops_per_iteration
+            << ", \"gb_per_s\": " << s.gb_per_s()
+            << ", \"gflop_per_s\": " << s.gflop_per_s()
+            << ", \"roofline_fraction\": " << roofline_fraction(s) << "}";
+        sep = ",";
+      } else {
+        out << s.pattern << ',' << detail::csv_quote(s.name) << ','
+            << detail::csv_quote(s.policy) << ','
+            << detail::csv_quote(s.file) << ',' << s.line << ',' << s.calls << ','
+            << s.samples << ',' << s.estimated_total_seconds() << ',' << mean
+            << ',' << s.min_seconds << ',' << s.max_seconds << ','
+            << s.percentile(0.5) << ',' << s.percentile(0.9) << ','
+            << s.percentile(0.99) << ',' << its_per_s << ','
+            << s.work.bytes_per_iteration << ','
+            << s.work.flops_per_iteration << ',' << s.gb_per_s() << ','
+            << s.gflop_per_s() << ',' << roofline_fraction(s) << '\n';
+      }
+    }
+    if (json) {
+      out << "\n]}\n";
+    }
+  }
+
+private:
+  struct Launch {
+    KernelStats* stats;
+    std::size_t generation;
+    bool sampled;
+    clock::time_point start;
+  };
+
+  // write the report and clear the statistics, the bandwidth probe only runs
+  // when measure_peak is set
+  void report(bool measure_peak)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (measure_peak && m_peak_gbs <= 0.0 &&
+        std::any_of(m_stats.begin(), m_stats.end(),
+                    [](const std::pair<const std::string, KernelStats>& s) {
+                      return !s.second.work.empty();
+                    })) {
+      m_peak_gbs = stream_triad_bandwidth(m_probe_size);
+    }
+    if (m_output.empty()) {
+      write_report(std::cout, m_json);
+    } else {
+      std::ofstream out(m_output);
+      if (out) {
+        write_report(out, m_json);
+      } else {
+        std::fprintf(stderr, "[ProfilerPlugin]: could not open %s\n",
+                     m_output.c_str());
+      }
+    }
+    m_stats.clear();
+    ++m_generation;
+  }
+
+  static std::string make_key(const PluginContext& p)
+  {
+    return std::string(pattern_name(p.pattern)) + '\n' +
+           (p.kernel_name ? p.kernel_name : "") + '\n' +
+           (p.policy_name ? p.policy_name : "") + '\n' +
+           (p.location.file ? p.location.file : "") + ':' +
+           std::to_string(p.location.line);
+  }
+
+  static KernelStats make_stats(const PluginContext& p)
+  {
+    KernelStats stats;
+    stats.name = p.kernel_name ? p.kernel_name : "";
+    stats.policy = p.policy_name ? p.policy_name : "";
+    stats.pattern = pattern_name(p.pattern);
+    stats.file = p.location.file ? p.location.file : "";
+    stats.line = p.location.line;
+    stats.work = p.work;
+    return stats;
+  }
+
+  // launches in flight on this thread, innermost last
+  static std::vector<std::pair<const ProfilerPlugin*, Launch>>& launches()
+  {
+    thread_local std::vector<std::pair<const ProfilerPlugin*, Launch>> stack;
+    return stack;
+  }
+
+  void configure(const PluginOptions& p)
+  {
+    const long rate = std::atol(p.get("RAJA_PROFILER_SAMPLE_RATE", "1").c_str());
+    m_sample_rate = rate > 0 ? static_cast<std::size_t>(rate) : 1;
+    m_output = p.get("RAJA_PROFILER_OUTPUT");
+    const std::string format = p.get("RAJA_PROFILER_FORMAT");
+    if (format.empty()) {
+      m_json = detail::ends_with(m_output, ".json");
+    } else {
+      m_json = (format == "json");
+    }
+    m_peak_gbs = std::atof(p.get("RAJA_PROFILER_PEAK_GBS", "0").c_str());
+    m_peak_gflops = std::atof(p.get("RAJA_PROFILER_PEAK_GFLOPS", "0").c_str());
+    const long probe_size =
+        std::atol(p.get("RAJA_PROFILER_PROBE_SIZE", "8388608").c_str());
+    m_probe_size = probe_size > 0 ? static_cast<std::size_t>(probe_size)
+                                  : 8388608;
+  }
+
+  std::size_t m_sample_rate{1};
+  std::string m_output;
+  bool m_json{false};
+  double m_peak_gbs{0.0};
+  double m_peak_gflops{0.0};
+  std::size_t m_probe_size{8388608};
+
+  std::size_t m_generation{0};
+  std::mutex m_mutex;
+  std::map<std::string, KernelStats> m_stats;
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
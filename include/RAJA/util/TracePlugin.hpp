@@ -0,0 +1,380 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Trace_Plugin_HPP
+#define RAJA_Trace_Plugin_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * \brief Plugin recording a timeline of kernel launches and writing it in
+ *        the Chrome trace event format, viewable in Perfetto or
+ *        chrome://tracing.
+ *
+ * Every thread that launches kernels, e.g. each thread of an
+ * omp_parallel_region, records into its own ring buffer, so recording takes
+ * no locks and the newest events are kept if the buffer overflows. When RAJA
+ * is configured with RAJA_ENABLE_OPENMP_IMBALANCE, the share of every OpenMP
+ * thread in the parallel loops of a launch is recorded as well and shown on
+ * its own track under the launching thread. The trace is written by
+ * finalize(), or when the plugin is destroyed; kernels should not be running
+ * at that point. Settings are read through PluginOptions:
+ *
+ *   RAJA_TRACE_OUTPUT       trace file, default raja-trace.json
+ *   RAJA_TRACE_BUFFER_SIZE  events kept per thread, default 65536
+ */
+class TracePlugin : public PluginStrategy
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  static constexpr std::size_t max_name_length = 63;
+
+  struct Event {
+    char name[max_name_length + 1];
+    const char* policy;
+    PluginPattern pattern;
+    std::int64_t start_ns;
+    std::int64_t duration_ns;
+    std::size_t num_iterations;
+    //! OpenMP thread of a parallel loop share, -1 for the launch itself
+    int omp_thread;
+  };
+
+  /*!
+   * \brief Events recorded by one thread, oldest overwritten first.
+   *
+   * Storage is allocated in chunks of chunk_size events as the buffer
+   * fills, so threads that record little stay small. Only the owning thread
+   * pushes; readers see every event pushed before the last release of
+   * m_count.
+   */
+  class RingBuffer
+  {
+  public:
+    static constexpr std::size_t chunk_size = 1024;
+
+    RingBuffer(std::size_t capacity, int tid, int omp_thread)
+        : m_capacity(std::max<std::size_t>(capacity, 1)),
+          m_chunks((m_capacity + chunk_size - 1) / chunk_size),
+          m_tid(tid),
+          m_omp_thread(omp_thread)
+    {
+    }
+
+    void push(const Event& event)
+    {
+      const std::size_t n = m_count.load(std::memory_order_relaxed);
+      const std::size_t i = n % m_capacity;
+      std::unique_ptr<Event[]>& chunk = m_chunks[i / chunk_size];
+      if (!chunk) {
+        chunk.reset(new Event[chunk_length(i / chunk_size)]);
+      }
+      chunk[i % chunk_size] = event;
+      m_count.store(n + 1, std::memory_order_release);
+    }
+
+    template <typename Func>
+    void for_each(Func&& func) const
+    {
+      const std::size_t n = m_count.load(std::memory_order_acquire);
+      const std::size_t first = n > m_capacity ? n - m_capacity : 0;
+      for (std::size_t i = first; i < n; ++i) {
+        const std::size_t j = i % m_capacity;
+        func(m_chunks[j / chunk_size][j % chunk_size]);
+      }
+    }
+
+    //! events overwritten before they were written out
+    std::size_t dropped() const
+    {
+      const std::size_t n = m_count.load(std::memory_order_acquire);
+      return n > m_capacity ? n - m_capacity : 0;
+    }
+
+    //! events the allocated chunks can hold
+    std::size_t allocated() const
+    {
+      std::size_t size = 0;
+      for (std::size_t c = 0; c < m_chunks.size(); ++c) {
+        if (m_chunks[c]) size += chunk_length(c);
+      }
+      return size;
+    }
+
+    bool empty() const
+    {
+      return m_count.load(std::memory_order_acquire) == 0;
+    }
+
+    //! forget the events, the chunks are kept for reuse
+    void clear() { m_count.store(0, std::memory_order_release); }
+
+    int tid() const { return m_tid; }
+
+    //! OpenMP thread number when the buffer was created, -1 outside OpenMP
+    int omp_thread() const { return m_omp_thread; }
+
+  private:
+    //! the last chunk only holds what is left of the capacity
+    std::size_t chunk_length(std::size_t c) const
+    {
+      const std::size_t left = m_capacity - c * chunk_size;
+      return left < chunk_size ? left : chunk_size;
+    }
+
+    std::size_t m_capacity;
+    std::vector<std::unique_ptr<Event[]>> m_chunks;
+    std::atomic<std::size_t> m_count{0};
+    int m_tid;
+    int m_omp_thread;
+  };
+
+  TracePlugin()
+      : m_id(next_id().fetch_add(1, std::memory_order_relaxed)),
+        m_epoch(clock::now())
+  {
+    configure(make_options(""));
+  }
+
+  TracePlugin(const TracePlugin&) = delete;
+  TracePlugin& operator=(const TracePlugin&) = delete;
+
+  ~TracePlugin() override
+  {
+    // programs often never call finalize_plugins, write what we have
+    if (has_events()) {
+      finalize();
+    }
+  }
+
+  void init(const PluginOptions& p) override { configure(p); }
+
+  void preLaunch(const PluginContext& RAJA_UNUSED_ARG(p)) override
+  {
+    launches().emplace_back(m_id, clock::now());
+  }
+
+  void postLaunch(const PluginContext& p) override
+  {
+    const clock::time_point stop = clock::now();
+
+    auto& stack = launches();
+    auto it = std::find_if(stack.rbegin(), stack.rend(),
+                           [this](const std::pair<std::size_t,
+                                                  clock::time_point>& l) {
+                             return l.first == m_id;
+                           });
+    if (it == stack.rend()) return;
+
+    const clock::time_point start = it->second;
+    stack.erase(std::next(it).base());
+
+    Event event;
+    const char* name = p.kernel_name ? p.kernel_name : pattern_name(p.pattern);
+    std::strncpy(event.name, name, max_name_length);
+    event.name[max_name_length] = '\0';
+    event.policy = p.policy_name;
+    event.pattern = p.pattern;
+    event.start_ns = nanoseconds(start - m_epoch);
+    event.duration_ns = nanoseconds(stop - start);
+    event.num_iterations = p.num_iterations;
+    event.omp_thread = -1;
+
+    RingBuffer& buf = buffer();
+    buf.push(event);
+
+    // shares of the OpenMP threads, measured by the parallel loops
+    for (std::size_t i = 0; i < p.imbalance.num_spans; ++i) {
+      const ThreadSpan& span = p.imbalance.spans[i];
+      event.start_ns = nanoseconds(span.start - m_epoch);
+      event.duration_ns = nanoseconds(span.stop - span.start);
+      event.num_iterations = span.iterations;
+      event.omp_thread = span.thread;
+      buf.push(event);
+    }
+  }
+
+  void finalize() override
+  {
+    std::ofstream out(m_output);
+    if (out) {
+      write_trace(out);
+    } else {
+      std::fprintf(stderr, "[TracePlugin]: could not open %s\n",
+                   m_output.c_str());
+    }
+  }
+
+  //! write the recorded events as a Chrome trace and clear the buffers
+  void write_trace(std::ostream& out)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // timestamps are microseconds, keep nanosecond resolution
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    const char* sep = "\n";
+    for (const auto& buf : m_buffers) {
+      std::string thread_name = "thread " + std::to_string(buf->tid());
+      if (buf->omp_thread() >= 0) {
+        thread_name += " (OpenMP thread " + std::to_string(buf->omp_thread()) +
+                       ")";
+      }
+      out << sep << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, "
+          << "\"tid\": " << buf->tid() << ", \"args\": {\"name\": "
+          << detail::json_quote(thread_name)
+          << ", \"dropped_events\": " << buf->dropped() << "}}";
+      sep = ",\n";
+
+      // OpenMP threads named on first use, their events may be dropped
+      std::vector<bool> named;
+
+      buf->for_each([&](const Event& e) {
+        int tid = buf->tid();
+        if (e.omp_thread >= 0) {
+          tid = omp_track(buf->tid(), e.omp_thread);
+          if (named.size() <= static_cast<std::size_t>(e.omp_thread)) {
+            named.resize(e.omp_thread + 1, false);
+          }
+          if (!named[e.omp_thread]) {
+            named[e.omp_thread] = true;
+            out << sep << "{\"name\": \"thread_name\", \"ph\": \"M\", "
+                << "\"pid\": 0, \"tid\": " << tid << ", \"args\": {\"name\": "
+                << detail::json_quote(thread_name + " / OpenMP thread " +
+                                      std::to_string(e.omp_thread))
+                << "}}";
+          }
+        }
+        out << sep << "{\"name\": " << detail::json_quote(e.name)
+            << ", \"cat\": \"" << pattern_name(e.pattern)
+            << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << tid
+            << ", \"ts\": " << microseconds(e.start_ns)
+            << ", \"dur\": " << microseconds(e.duration_ns)
+            << ", \"args\": {\"policy\": "
+            << detail::json_quote(e.policy ? e.policy : "")
+            << ", \"iterations\": " << e.num_iterations << "}}";
+      });
+      buf->clear();
+    }
+    out << "\n]}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+  }
+
+private:
+  static std::atomic<std::size_t>& next_id()
+  {
+    static std::atomic<std::size_t> id{0};
+    return id;
+  }
+
+  // start times of the launches in flight on this thread, innermost last
+  static std::vector<std::pair<std::size_t, clock::time_point>>& launches()
+  {
+    thread_local std::vector<std::pair<std::size_t, clock::time_point>> stack;
+    return stack;
+  }
+
+  //! ring buffer of the calling thread, created on its first event
+  RingBuffer& buffer()
+  {
+    // keyed by id rather than address, a later plugin may reuse the address
+    thread_local std::vector<std::pair<std::size_t, RingBuffer*>> cache;
+    for (const auto& entry : cache) {
+      if (entry.first == m_id) return *entry.second;
+    }
+
+    int omp_thread = -1;
+#if defined(RAJA_ENABLE_OPENMP)
+    if (omp_in_parallel()) omp_thread = omp_get_thread_num();
+#endif
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.emplace_back(new RingBuffer(
+        m_capacity, static_cast<int>(m_buffers.size()), omp_thread));
+    cache.emplace_back(m_id, m_buffers.back().get());
+    return *m_buffers.back();
+  }
+
+  bool has_events()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::any_of(m_buffers.begin(), m_buffers.end(),
+                       [](const std::unique_ptr<RingBuffer>& buf) {
+                         return !buf->empty();
+                       });
+  }
+
+  void configure(const PluginOptions& p)
+  {
+    m_output = p.get("RAJA_TRACE_OUTPUT", "raja-trace.json");
+    const long capacity =
+        std::atol(p.get("RAJA_TRACE_BUFFER_SIZE", "65536").c_str());
+    m_capacity = capacity > 0 ? static_cast<std::size_t>(capacity) : 65536;
+  }
+
+  static std::int64_t nanoseconds(clock::duration d)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  }
+
+  static double microseconds(std::int64_t ns) { return double(ns) * 1.0e-3; }
+
+  //! track of the OpenMP thread shares of the launches of a thread
+  static int omp_track(int tid, int omp_thread)
+  {
+    return (tid + 1) * 10000 + omp_thread;
+  }
+
+  const std::size_t m_id;
+  const clock::time_point m_epoch;
+
+  std::string m_output;
+  std::size_t m_capacity{65536};
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<RingBuffer>> m_buffers;
+};
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
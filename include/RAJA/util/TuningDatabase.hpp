@@ -0,0 +1,146 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Tuning_Database_HPP
+#define RAJA_Tuning_Database_HPP
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * \brief Thread safe table of tuning decisions that can be kept in a file
+ *        across runs.
+ *
+ * Each line of the file holds a key and a value separated by the last tab
+ * on the line. Keys may be made of several tab separated fields; newlines in
+ * keys, and tabs and newlines in values, are replaced by spaces. A database
+ * constructed with a path reads that file and, if anything was set, writes it
+ * back when destroyed.
+ */
+class TuningDatabase
+{
+public:
+  TuningDatabase() = default;
+
+  explicit TuningDatabase(std::string path) : m_path(std::move(path))
+  {
+    if (!m_path.empty()) {
+      load(m_path);
+    }
+  }
+
+  TuningDatabase(const TuningDatabase&) = delete;
+  TuningDatabase& operator=(const TuningDatabase&) = delete;
+
+  ~TuningDatabase()
+  {
+    if (!m_path.empty() && m_modified) {
+      save(m_path);
+    }
+  }
+
+  //! file the database is loaded from and saved to, empty if none
+  const std::string& path() const { return m_path; }
+
+  //! value stored for key, false if there is none
+  bool get(const std::string& key, std::string& value) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) return false;
+    value = it->second;
+    return true;
+  }
+
+  void set(const std::string& key, const std::string& value)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[sanitize(key, false)] = sanitize(value, true);
+    m_modified = true;
+  }
+
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_modified = true;
+  }
+
+  //! add the entries of a file, replacing existing keys
+  bool load(const std::string& path)
+  {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string line;
+    while (std::getline(in, line)) {
+      const std::size_t tab = line.rfind('\t');
+      if (tab == std::string::npos || tab == 0) continue;
+      m_entries[line.substr(0, tab)] = line.substr(tab + 1);
+    }
+    return true;
+  }
+
+  bool save(const std::string& path) const
+  {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& entry : m_entries) {
+      out << entry.first << '\t' << entry.second << '\n';
+    }
+    return static_cast<bool>(out);
+  }
+
+private:
+  static std::string sanitize(std::string str, bool replace_tabs)
+  {
+    for (char& c : str) {
+      if ((replace_tabs && c == '\t') || c == '\n' || c == '\r') c = ' ';
+    }
+    return str;
+  }
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, std::string> m_entries;
+  std::string m_path;
+  bool m_modified{false};
+};
+
+/*!
+ * \brief Database shared by RAJA's tuning facilities.
+ *
+ * It is kept in the file named by the RAJA_TUNING_FILE environment variable,
+ * read on first use and written at program exit, or only in memory if the
+ * variable is not set.
+ */
+inline TuningDatabase& tuning_database()
+{
+  static TuningDatabase database(
+      std::getenv("RAJA_TUNING_FILE") ? std::getenv("RAJA_TUNING_FILE") : "");
+  return database;
+}
+
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
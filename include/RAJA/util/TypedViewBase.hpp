@@ -26,6 +26,7 @@
 
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/VectorIndex.hpp"
 
 namespace RAJA
 {
@@ -77,7 +78,43 @@ namespace internal
   RAJA_INLINE
   RAJA_HOST_DEVICE
   static constexpr camp::idx_t count_num_tensor_args(){
-		return 0;
+    return RAJA::sum<camp::idx_t>(camp::idx_t(0),
+                                  camp::idx_t(is_vector_index<ARGS>::value)...);
+  }
+
+  /*
+   * Returns the position of the first argument which is a VectorIndex
+   */
+  template<typename ... ARGS>
+  RAJA_INLINE
+  static constexpr camp::idx_t vector_arg_position(){
+    bool const is_vector[] = {false, is_vector_index<ARGS>::value...};
+    for(camp::idx_t i = 0; i < camp::idx_t(sizeof...(ARGS)); ++i){
+      if(is_vector[i+1]){
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  /*
+   * Replaces a VectorIndex argument with the index of one of its lanes,
+   * leaving scalar arguments unchanged
+   */
+  template<typename Arg>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  Arg const &vector_lane_index(Arg const &arg, camp::idx_t){
+    return arg;
+  }
+
+  template<typename IdxType, typename RegisterType>
+  RAJA_INLINE
+  constexpr
+  strip_index_type_t<IdxType>
+  vector_lane_index(VectorIndex<IdxType, RegisterType> const &arg, camp::idx_t lane){
+    return stripIndexType(arg.begin()) + lane;
   }
 
 
@@ -89,13 +126,12 @@ namespace internal
    *
    * For scalars, this just returns the scalar.
    *
-   * In the future development, this may return SIMD vectors or matrices using
-   * class specializations.
+   * With one VectorIndex argument this returns a VectorRef to its lanes.
    */
   template<camp::idx_t NumVectors, typename Args, typename ElementType, typename PointerType, typename LinIdx, camp::idx_t StrideOneDim>
   struct ViewReturnHelper
   {
-      static_assert(NumVectors == 0, "Vectors and Matrices not supported yet");
+      static_assert(NumVectors <= 1, "Only one VectorIndex argument per View access is supported");
   };
 
 
@@ -118,6 +154,36 @@ namespace internal
   };
 
 
+  /*
+   * Specialization for vector return types
+   *
+   * The lanes are contiguous when the vectorized argument is the stride-one
+   * dimension, otherwise their stride is taken from the layout.
+   */
+  template<typename ... Args, typename ElementType, typename PointerType, typename LinIdx, camp::idx_t StrideOneDim>
+  struct ViewReturnHelper<1, camp::list<Args...>, ElementType, PointerType, LinIdx, StrideOneDim>
+  {
+      static constexpr camp::idx_t vector_arg = vector_arg_position<Args...>();
+
+      using vector_index_type = camp::at_v<camp::list<Args...>, vector_arg>;
+
+      using return_type = VectorRef<typename vector_index_type::register_type, PointerType>;
+
+      template<typename LayoutType>
+      RAJA_INLINE
+      static
+      return_type make_return(LayoutType const &layout, PointerType const &data, Args const &... args){
+        auto first = stripIndexType(layout(vector_lane_index(args, 0)...));
+        auto const &vec = camp::get<vector_arg>(camp::forward_as_tuple(args...));
+        camp::idx_t stride = 1;
+        if(vector_arg != StrideOneDim && vec.size() > 1){
+          stride = stripIndexType(layout(vector_lane_index(args, 1)...)) - first;
+        }
+        return return_type(data + first, stride, vec.size());
+      }
+  };
+
+
 
   } // namespace detail
 
@@ -192,6 +258,24 @@ namespace internal
     }
   };
 
+  /*
+   * Specialization for VectorIndex arguments, which strips the strongly
+   * typed index of the first lane
+   */
+  template<typename Expected, typename IdxType, typename RegisterType>
+  struct MatchTypedViewArgHelper<Expected, VectorIndex<IdxType, RegisterType>>{
+    static_assert(std::is_convertible<IdxType, Expected>::value,
+        "VectorIndex argument isn't compatible");
+
+    using type = VectorIndex<strip_index_type_t<IdxType>, RegisterType>;
+
+    static RAJA_INLINE
+    constexpr
+    type extract(VectorIndex<IdxType, RegisterType> arg){
+      return type(stripIndexType(arg.begin()), arg.size());
+    }
+  };
+
 
   } //namespace detail
 
@@ -0,0 +1,262 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the vector index and the vector
+ *          reference returned by Views indexed with it.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_VectorIndex_HPP
+#define RAJA_util_VectorIndex_HPP
+
+#include <type_traits>
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * A run of consecutive loop indices [begin, begin+size) processed together
+ * in one register of RegisterType.
+ *
+ * simd_vector_exec passes these to loop bodies instead of scalar indices.
+ * size() is num_lanes except for the remainder of a loop, where it is the
+ * number of indices left. Indexing a View with a VectorIndex returns a
+ * VectorRef, which loads and stores all of them at once.
+ */
+template <typename IdxType, typename RegisterType>
+class VectorIndex
+{
+public:
+  using index_type = IdxType;
+  using register_type = RegisterType;
+
+  static constexpr camp::idx_t num_lanes = RegisterType::num_lanes;
+
+  RAJA_INLINE constexpr VectorIndex() : m_begin(0), m_length(num_lanes) {}
+
+  RAJA_INLINE constexpr VectorIndex(IdxType begin, camp::idx_t length)
+      : m_begin(begin), m_length(length)
+  {
+  }
+
+  RAJA_INLINE constexpr IdxType begin() const { return m_begin; }
+
+  RAJA_INLINE constexpr camp::idx_t size() const { return m_length; }
+
+private:
+  IdxType m_begin;
+  camp::idx_t m_length;
+};
+
+template <typename IdxType, typename RegisterType>
+constexpr camp::idx_t VectorIndex<IdxType, RegisterType>::num_lanes;
+
+
+template <typename T>
+struct is_vector_index : std::false_type {
+};
+
+template <typename IdxType, typename RegisterType>
+struct is_vector_index<VectorIndex<IdxType, RegisterType>> : std::true_type {
+};
+
+
+/*!
+ * Reference to the elements of a View addressed by a VectorIndex.
+ *
+ * Reading converts to a register and assigning stores one. When the
+ * vectorized dimension is the stride-one dimension of the layout the
+ * accesses are contiguous loads and stores, otherwise they are strided;
+ * either way only size() lanes are touched.
+ */
+template <typename RegisterType, typename PointerType>
+class VectorRef
+{
+public:
+  using register_type = RegisterType;
+  using element_type = typename RegisterType::element_type;
+
+  static_assert(std::is_same<typename std::remove_cv<typename std::remove_pointer<
+                                 PointerType>::type>::type,
+                             element_type>::value,
+                "View element type must match the VectorIndex register type");
+
+  RAJA_INLINE VectorRef(PointerType data,
+                        camp::idx_t stride,
+                        camp::idx_t length)
+      : m_data(data), m_stride(stride), m_length(length)
+  {
+  }
+
+  VectorRef(VectorRef const &) = default;
+
+  RAJA_INLINE PointerType get_pointer() const { return m_data; }
+
+  RAJA_INLINE camp::idx_t get_stride() const { return m_stride; }
+
+  RAJA_INLINE camp::idx_t size() const { return m_length; }
+
+  RAJA_INLINE register_type load() const
+  {
+    register_type value;
+    if (m_stride != 1) {
+      value.load_strided(m_data, m_stride, m_length);
+    } else if (m_length == register_type::num_lanes) {
+      value.load(m_data);
+    } else {
+      value.load_n(m_data, m_length);
+    }
+    return value;
+  }
+
+  RAJA_INLINE void store(register_type const &value) const
+  {
+    if (m_stride != 1) {
+      value.store_strided(m_data, m_stride, m_length);
+    } else if (m_length == register_type::num_lanes) {
+      value.store(m_data);
+    } else {
+      value.store_n(m_data, m_length);
+    }
+  }
+
+  RAJA_INLINE operator register_type() const { return load(); }
+
+  RAJA_INLINE VectorRef &operator=(register_type const &value)
+  {
+    store(value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef &operator=(VectorRef const &other)
+  {
+    store(other.load());
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef &operator+=(register_type const &value)
+  {
+    store(load() + value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef &operator-=(register_type const &value)
+  {
+    store(load() - value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef &operator*=(register_type const &value)
+  {
+    store(load() * value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef &operator/=(register_type const &value)
+  {
+    store(load() / value);
+    return *this;
+  }
+
+  RAJA_INLINE friend register_type operator+(VectorRef const &a,
+                                             VectorRef const &b)
+  {
+    return a.load() + b.load();
+  }
+
+  RAJA_INLINE friend register_type operator+(VectorRef const &a,
+                                             register_type const &b)
+  {
+    return a.load() + b;
+  }
+
+  RAJA_INLINE friend register_type operator+(register_type const &a,
+                                             VectorRef const &b)
+  {
+    return a + b.load();
+  }
+
+  RAJA_INLINE friend register_type operator-(VectorRef const &a,
+                                             VectorRef const &b)
+  {
+    return a.load() - b.load();
+  }
+
+  RAJA_INLINE friend register_type operator-(VectorRef const &a,
+                                             register_type const &b)
+  {
+    return a.load() - b;
+  }
+
+  RAJA_INLINE friend register_type operator-(register_type const &a,
+                                             VectorRef const &b)
+  {
+    return a - b.load();
+  }
+
+  RAJA_INLINE friend register_type operator*(VectorRef const &a,
+                                             VectorRef const &b)
+  {
+    return a.load() * b.load();
+  }
+
+  RAJA_INLINE friend register_type operator*(VectorRef const &a,
+                                             register_type const &b)
+  {
+    return a.load() * b;
+  }
+
+  RAJA_INLINE friend register_type operator*(register_type const &a,
+                                             VectorRef const &b)
+  {
+    return a * b.load();
+  }
+
+  RAJA_INLINE friend register_type operator/(VectorRef const &a,
+                                             VectorRef const &b)
+  {
+    return a.load() / b.load();
+  }
+
+  RAJA_INLINE friend register_type operator/(VectorRef const &a,
+                                             register_type const &b)
+  {
+    return a.load() / b;
+  }
+
+  RAJA_INLINE friend register_type operator/(register_type const &a,
+                                             VectorRef const &b)
+  {
+    return a / b.load();
+  }
+
+  RAJA_INLINE friend register_type operator-(VectorRef const &a)
+  {
+    return -a.load();
+  }
+
+private:
+  PointerType m_data;
+  camp::idx_t m_stride;
+  camp::idx_t m_length;
+};
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -13,6 +13,9 @@
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/PluginStrategy.hpp"
+#if defined(RAJA_ENABLE_OPENMP_IMBALANCE)
+#include "RAJA/util/ImbalanceRecorder.hpp"
+#endif
 #if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
@@ -28,10 +31,22 @@ RAJA_INLINE auto trigger_updates_before(T&& item)
   return item;
 }
 
+#if defined(RAJA_ENABLE_PLUGINS)
+
+//! false until a plugin exists, so launches without plugins cost one branch
+RAJA_INLINE
+bool
+plugins_active()
+{
+  return detail::plugins_created;
+}
+
 RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -44,6 +59,8 @@ RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -56,6 +73,8 @@ RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -68,6 +87,8 @@ RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -76,6 +97,96 @@ callPostLaunchPlugins(const PluginContext& p)
   }
 }
 
+#else
+
+// plugins are compiled out, the calls vanish after inlining
+
+RAJA_INLINE
+constexpr bool
+plugins_active()
+{
+  return false;
+}
+
+RAJA_INLINE
+void
+callPreCapturePlugins(const PluginContext&)
+{
+}
+
+RAJA_INLINE
+void
+callPostCapturePlugins(const PluginContext&)
+{
+}
+
+RAJA_INLINE
+void
+callPreLaunchPlugins(const PluginContext&)
+{
+}
+
+RAJA_INLINE
+void
+callPostLaunchPlugins(const PluginContext&)
+{
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP_IMBALANCE)
+
+/*!
+ * \brief Measures the load balance of the OpenMP parallel loops a launch
+ *        runs on the calling thread, stored in the context by finish().
+ *
+ * Nothing is measured when there are no plugins.
+ */
+class ImbalanceScope
+{
+public:
+  ImbalanceScope() : m_active(plugins_active())
+  {
+    if (m_active) {
+      m_previous = detail::current_imbalance_recorder();
+      detail::current_imbalance_recorder() = &m_recorder;
+    }
+  }
+
+  ImbalanceScope(const ImbalanceScope&) = delete;
+  ImbalanceScope& operator=(const ImbalanceScope&) = delete;
+
+  ~ImbalanceScope()
+  {
+    if (m_active) {
+      detail::current_imbalance_recorder() = m_previous;
+    }
+  }
+
+  void finish(PluginContext& p)
+  {
+    if (!m_active) return;
+    detail::current_imbalance_recorder() = m_previous;
+    m_active = false;
+    p.imbalance = m_recorder.result();
+  }
+
+private:
+  bool m_active;
+  detail::ImbalanceRecorder* m_previous{nullptr};
+  detail::ImbalanceRecorder m_recorder;
+};
+
+#else
+
+class ImbalanceScope
+{
+public:
+  void finish(PluginContext&) {}
+};
+
+#endif
+
 RAJA_INLINE
 void
 callInitPlugins(const PluginOptions p)
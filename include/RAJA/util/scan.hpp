@@ -0,0 +1,173 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan templates shared by the CPU
+*          scan back-ends.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_scan_HPP
+#define RAJA_util_scan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Shared state for a single-pass scan using decoupled look-back.
+ *
+ * The input is split into tiles of tile_size elements. Workers claim tiles
+ * in increasing order, reduce them, and publish the tile aggregate. A tile
+ * then walks back over its predecessors, combining aggregates until it finds
+ * a published inclusive prefix, publishes its own inclusive prefix and
+ * writes its output. Each element is read twice and written once, and no
+ * barrier separates the tiles.
+ *
+ * Tiles are handed out through an atomic counter rather than by the caller
+ * so a tile is only ever waited on after it has been claimed by a running
+ * worker; this keeps the look-back deadlock free under any scheduler.
+ * Callers must invoke process_next_tile() exactly num_tiles() times.
+ */
+template <typename Value, typename DistanceT>
+class LookbackScan
+{
+public:
+  LookbackScan(DistanceT n, DistanceT tile_size)
+      : m_n(n),
+        m_tile_size(tile_size),
+        m_num_tiles((n + tile_size - 1) / tile_size),
+        m_next_tile(0),
+        m_status(allocate_aligned_type<TileStatus>(alignof(TileStatus),
+                                                   m_num_tiles *
+                                                       sizeof(TileStatus)))
+  {
+    for (DistanceT t = 0; t < m_num_tiles; ++t) {
+      new (&m_status[t]) TileStatus();
+    }
+  }
+
+  LookbackScan(LookbackScan const&) = delete;
+  LookbackScan& operator=(LookbackScan const&) = delete;
+
+  ~LookbackScan()
+  {
+    for (DistanceT t = 0; t < m_num_tiles; ++t) {
+      m_status[t].~TileStatus();
+    }
+    free_aligned(m_status);
+  }
+
+  DistanceT num_tiles() const { return m_num_tiles; }
+
+  /*!
+   * \brief Claim the next tile and scan it from in into out, which may alias.
+   *
+   * init is combined ahead of the first element; for an inclusive scan it
+   * should be the identity of f.
+   */
+  template <bool Inclusive, typename Iter, typename OutIter, typename BinFn>
+  void process_next_tile(Iter in, OutIter out, BinFn f, Value init)
+  {
+    const DistanceT tile = m_next_tile.fetch_add(1, std::memory_order_relaxed);
+    if (tile >= m_num_tiles) {
+      return;
+    }
+
+    const DistanceT idx_begin = tile * m_tile_size;
+    const DistanceT idx_end = std::min(idx_begin + m_tile_size, m_n);
+
+    Value agg = BinFn::identity();
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      agg = f(agg, in[i]);
+    }
+
+    TileStatus& status = m_status[tile];
+    Value prefix = init;
+    if (tile != 0) {
+      status.aggregate = agg;
+      status.flag.store(status_aggregate, std::memory_order_release);
+      prefix = look_back(tile, f);
+    }
+    status.inclusive_prefix = f(prefix, agg);
+    status.flag.store(status_prefix, std::memory_order_release);
+
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      // read before write so out may alias the input
+      const Value t = in[i];
+      if (Inclusive) {
+        prefix = f(prefix, t);
+        out[i] = prefix;
+      } else {
+        out[i] = prefix;
+        prefix = f(prefix, t);
+      }
+    }
+  }
+
+private:
+  enum : int { status_invalid = 0, status_aggregate = 1, status_prefix = 2 };
+
+  struct RAJA_ALIGNED_ATTR(DATA_ALIGN) TileStatus {
+    std::atomic<int> flag{status_invalid};
+    Value aggregate;
+    Value inclusive_prefix;
+  };
+
+  /*!
+   * \brief Combine predecessor aggregates back to the nearest published
+   *        inclusive prefix and return the exclusive prefix of tile.
+   */
+  template <typename BinFn>
+  Value look_back(DistanceT tile, BinFn f) const
+  {
+    Value excl = BinFn::identity();
+    for (DistanceT pred = tile - 1;; --pred) {
+      const TileStatus& pred_status = m_status[pred];
+      int flag = pred_status.flag.load(std::memory_order_acquire);
+      while (flag == status_invalid) {
+        std::this_thread::yield();
+        flag = pred_status.flag.load(std::memory_order_acquire);
+      }
+      if (flag == status_prefix) {
+        return f(pred_status.inclusive_prefix, excl);
+      }
+      excl = f(pred_status.aggregate, excl);
+    }
+  }
+
+  const DistanceT m_n;
+  const DistanceT m_tile_size;
+  const DistanceT m_num_tiles;
+  std::atomic<DistanceT> m_next_tile;
+  TileStatus* m_status;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
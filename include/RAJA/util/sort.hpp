@@ -20,8 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -29,6 +36,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/Operators.hpp"
+
 namespace RAJA
 {
 
@@ -440,7 +449,8 @@ intro_sort(Iter begin,
 
 /*!
     \brief merge a range with midpoint using comparison function
-    with local range/2 copy
+    and a caller provided uninitialized buffer of at least middle - first
+    elements
 */
 template <typename Iter, typename Compare>
 void
@@ -448,7 +458,8 @@ RAJA_INLINE
 inplace_merge(  Iter first,
                 Iter middle,
                 Iter last,
-                Compare comp  )
+                Compare comp,
+                RAJA::detail::IterVal<Iter>* copyarr  )
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
   using value_type = RAJA::detail::IterVal<Iter>;
@@ -467,24 +478,17 @@ inplace_merge(  Iter first,
     return;
   }
 
-  // Manage the lifetime of the buffer and objects constructed in the buffer
-  using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
-  buf_deleter_type buf_deleter;
-
-  std::unique_ptr<value_type, buf_deleter_type&> copy_buf(
-      RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, copylen * sizeof(value_type) ),
-      buf_deleter);
-
-  value_type* copyarr = copy_buf.get();
+  // Manage the lifetime of the objects constructed in the buffer, the
+  // storage itself belongs to the caller
+  using buf_destroyer_type = DestroyType<value_type, diff_type>;
+  buf_destroyer_type buf_destroyer;
 
-  // check memory allocation worked
-  if (copyarr == nullptr) {
-    RAJA_ABORT_OR_THROW( "inplace_merge temporary memory allocation failed" );
-  }
+  std::unique_ptr<value_type, buf_destroyer_type&> copy_guard(
+      copyarr, buf_destroyer);
 
   // move construct input into buffer storage
-  // use buf_deleter.size as index to keep track of objects constructed
-  for ( diff_type& cc = buf_deleter.size; cc < copylen; ++cc )
+  // use buf_destroyer.size as index to keep track of objects constructed
+  for ( diff_type& cc = buf_destroyer.size; cc < copylen; ++cc )
   {
     new(&copyarr[cc]) value_type(std::move(first[cc]));
   }
@@ -517,6 +521,115 @@ inplace_merge(  Iter first,
   return;
 }
 
+/*!
+    \brief merge a range with midpoint using comparison function
+    with local range/2 copy
+*/
+template <typename Iter, typename Compare>
+void
+RAJA_INLINE
+inplace_merge(  Iter first,
+                Iter middle,
+                Iter last,
+                Compare comp  )
+{
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  if ( first == middle || middle == last )
+  {
+    // at least one side empty, already sorted
+    return;
+  }
+
+  if ( !comp(*middle, *(middle-1)) )
+  {
+    // everything already in order, done
+    return;
+  }
+
+  std::unique_ptr<value_type, FreeAligned> copy_buf(
+      RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, (middle - first) * sizeof(value_type) ));
+
+  // check memory allocation worked
+  if (copy_buf == nullptr) {
+    RAJA_ABORT_OR_THROW( "inplace_merge temporary memory allocation failed" );
+  }
+
+  detail::inplace_merge( first, middle, last, comp, copy_buf.get() );
+}
+
+/*!
+    \brief find the number of elements of [first1, first1+len1) among the
+    first diag elements of the stable merge with [first2, first2+len2)
+
+    This is the co-rank or merge path search, it uses O(lg(N)) comparisons.
+*/
+template <typename Iter1, typename Iter2, typename Compare>
+RAJA_INLINE
+RAJA::detail::IterDiff<Iter1>
+merge_path_search( Iter1 first1,
+                   RAJA::detail::IterDiff<Iter1> len1,
+                   Iter2 first2,
+                   RAJA::detail::IterDiff<Iter1> len2,
+                   RAJA::detail::IterDiff<Iter1> diag,
+                   Compare comp )
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type lo = ( diag > len2 ) ? diag - len2 : 0;
+  diff_type hi = ( diag < len1 ) ? diag : len1;
+
+  while ( lo < hi )
+  {
+    const diff_type mid = lo + (hi - lo) / 2;
+
+    // take from the second range only if strictly less to stay stable
+    if ( comp( first2[diag - mid - 1], first1[mid] ) )
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+/*!
+    \brief stable merge of two ranges using comparison function, move
+    constructing the result into uninitialized storage
+
+    Combined with merge_path_search this lets disjoint parts of one merge
+    run concurrently. The searches for all parts must complete before any
+    part is merged, as merging leaves the input elements moved from.
+*/
+template <typename Iter1, typename Iter2, typename T, typename Compare>
+RAJA_INLINE
+void
+uninitialized_move_merge( Iter1 first1,
+                          Iter1 last1,
+                          Iter2 first2,
+                          Iter2 last2,
+                          T* d_first,
+                          Compare comp )
+{
+  for ( ; first1 != last1 || first2 != last2; ++d_first )
+  {
+    if ( first1 != last1 && ( first2 == last2 || !comp( *first2, *first1 ) ) )
+    {
+      new(d_first) T(std::move(*first1));
+      ++first1;
+    }
+    else
+    {
+      new(d_first) T(std::move(*first2));
+      ++first2;
+    }
+  }
+}
+
 /*!
     \brief merge given two ranges using comparison function
     while copies are outside, somewhat follows STL API
@@ -693,6 +806,329 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief map arithmetic keys to unsigned integers with the same ordering
+    for use in radix sorts
+
+    Floating point keys treat -0.0 and +0.0 as equal, like the comparison
+    sorts, and do not support NaN.
+*/
+template <typename T, typename Enable = void>
+struct radix_key_traits : std::false_type
+{
+};
+
+template <typename T>
+struct radix_key_traits<T,
+    typename std::enable_if<std::is_integral<T>::value &&
+                            !std::is_same<T, bool>::value>::type>
+  : std::true_type
+{
+  using bits_type = typename std::make_unsigned<T>::type;
+
+  static RAJA_INLINE bits_type to_bits(T key)
+  {
+    // flip the sign bit of signed keys so negative keys order first
+    constexpr bits_type sign_bit = std::is_signed<T>::value
+        ? bits_type(bits_type(1) << (8*sizeof(bits_type) - 1))
+        : bits_type(0);
+    return static_cast<bits_type>(key) ^ sign_bit;
+  }
+};
+
+template <typename T>
+struct radix_key_traits<T,
+    typename std::enable_if<std::is_floating_point<T>::value &&
+                            (sizeof(T) == sizeof(uint32_t) ||
+                             sizeof(T) == sizeof(uint64_t))>::type>
+  : std::true_type
+{
+  using bits_type = typename std::conditional<sizeof(T) == sizeof(uint32_t),
+                                              uint32_t, uint64_t>::type;
+
+  static RAJA_INLINE bits_type to_bits(T key)
+  {
+    // map -0.0 to +0.0 so equal keys keep their order
+    if (key == T(0)) {
+      key = T(0);
+    }
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(T));
+    // flip all bits of negative keys and the sign bit of positive keys
+    constexpr bits_type sign_bit = bits_type(1) << (8*sizeof(bits_type) - 1);
+    return bits ^ ((bits & sign_bit) ? ~bits_type(0) : sign_bit);
+  }
+};
+
+/*!
+    \brief true if a range of Iter can be sorted by radix_sort with Compare
+*/
+template <typename Iter, typename Compare>
+struct radix_sortable
+  : concepts::all_of<
+      radix_key_traits<RAJA::detail::IterVal<Iter>>,
+      concepts::any_of<
+        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+{
+};
+
+/*!
+    \brief true if ranges of KeyIter and ValIter can be sorted by
+    radix_sort_pairs with Compare
+*/
+template <typename KeyIter, typename ValIter, typename Compare>
+struct radix_sortable_pairs
+  : concepts::all_of<
+      radix_sortable<KeyIter, Compare>,
+      std::is_trivially_copyable<RAJA::detail::IterVal<ValIter>>>
+{
+};
+
+/*!
+    \brief placeholder for the values of a radix sort of keys only
+*/
+struct radix_no_vals
+{
+  struct reference
+  {
+    RAJA_INLINE reference& operator=(reference const&) { return *this; }
+  };
+
+  template <typename diff_type>
+  RAJA_INLINE reference operator[](diff_type) const { return reference{}; }
+};
+
+/*!
+    \brief allocate an uninitialized buffer for a radix sort
+*/
+template <typename T>
+RAJA_INLINE
+std::unique_ptr<T, FreeAligned>
+radix_allocate(size_t len)
+{
+  std::unique_ptr<T, FreeAligned> buf(
+      RAJA::allocate_aligned_type<T>( RAJA::DATA_ALIGN, len * sizeof(T) ));
+
+  if (buf == nullptr) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+
+  return buf;
+}
+
+/*!
+    \brief one stable counting sort pass of a radix sort on the digit at
+    shift, returns false without moving anything if all keys share the digit
+
+    counts holds num_blocks*radix_size entries.
+*/
+template <bool Descending,
+          typename ForEachBlock,
+          typename SrcKeys, typename SrcVals,
+          typename DstKeys, typename DstVals,
+          typename diff_type>
+RAJA_INLINE
+bool
+radix_sort_pass(ForEachBlock&& for_each_block,
+                diff_type num_blocks,
+                SrcKeys src_keys, SrcVals src_vals,
+                DstKeys dst_keys, DstVals dst_vals,
+                diff_type n,
+                unsigned shift,
+                diff_type* counts)
+{
+  using RAJA::detail::firstIndex;
+  using key_type = typename std::remove_cv<
+      typename std::remove_reference<decltype(src_keys[0])>::type>::type;
+  using traits = radix_key_traits<key_type>;
+  using bits_type = typename traits::bits_type;
+
+  constexpr unsigned radix_bits = 8;
+  constexpr diff_type radix_size = diff_type(1) << radix_bits;
+  constexpr bits_type order_mask = Descending ? ~bits_type(0) : bits_type(0);
+
+  auto digit = [=](const key_type& key) {
+    return static_cast<diff_type>(
+        ((traits::to_bits(key) ^ order_mask) >> shift) & (radix_size - 1));
+  };
+
+  // per block histograms
+  for_each_block(num_blocks, [=](diff_type block) {
+    diff_type* block_counts = counts + block*radix_size;
+    for (diff_type d = 0; d < radix_size; ++d) {
+      block_counts[d] = 0;
+    }
+    const diff_type i_end = firstIndex(n, num_blocks, block + 1);
+    for (diff_type i = firstIndex(n, num_blocks, block); i < i_end; ++i) {
+      ++block_counts[digit(src_keys[i])];
+    }
+  });
+
+  // skip the pass when every key has the same digit
+  for (diff_type d = 0; d < radix_size; ++d) {
+    diff_type total = 0;
+    for (diff_type block = 0; block < num_blocks; ++block) {
+      total += counts[block*radix_size + d];
+    }
+    if (total == n) {
+      return false;
+    }
+    if (total != 0) {
+      break;
+    }
+  }
+
+  // scan histograms in (digit, block) order into scatter offsets
+  diff_type offset = 0;
+  for (diff_type d = 0; d < radix_size; ++d) {
+    for (diff_type block = 0; block < num_blocks; ++block) {
+      const diff_type count = counts[block*radix_size + d];
+      counts[block*radix_size + d] = offset;
+      offset += count;
+    }
+  }
+
+  // scatter each block keeping the order of equal digits
+  for_each_block(num_blocks, [=](diff_type block) {
+    diff_type* block_offsets = counts + block*radix_size;
+    const diff_type i_end = firstIndex(n, num_blocks, block + 1);
+    for (diff_type i = firstIndex(n, num_blocks, block); i < i_end; ++i) {
+      const diff_type j = block_offsets[digit(src_keys[i])]++;
+      dst_keys[j] = src_keys[i];
+      dst_vals[j] = src_vals[i];
+    }
+  });
+
+  return true;
+}
+
+/*!
+    \brief stable LSD radix sort of keys and values using the given
+    buffers, which must hold n elements
+
+    The range is split into num_blocks blocks. for_each_block(num_blocks, f)
+    calls f(block) for each block, possibly concurrently, and returns once
+    all calls are complete.
+*/
+template <bool Descending,
+          typename ForEachBlock,
+          typename KeyIter, typename ValIter,
+          typename KeyBuf, typename ValBuf,
+          typename diff_type>
+RAJA_INLINE
+void
+radix_sort_impl(ForEachBlock&& for_each_block,
+                diff_type num_blocks,
+                KeyIter keys, ValIter vals,
+                KeyBuf key_buf, ValBuf val_buf,
+                diff_type n)
+{
+  using RAJA::detail::firstIndex;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+  using bits_type = typename radix_key_traits<key_type>::bits_type;
+
+  constexpr unsigned radix_bits = 8;
+  constexpr diff_type radix_size = diff_type(1) << radix_bits;
+
+  if (n <= 1) {
+    return;
+  }
+
+  std::vector<diff_type> counts(num_blocks*radix_size);
+
+  bool in_buf = false;
+  for (unsigned shift = 0; shift < 8*sizeof(bits_type); shift += radix_bits) {
+    const bool moved = in_buf
+        ? radix_sort_pass<Descending>(for_each_block, num_blocks,
+                                      key_buf, val_buf, keys, vals,
+                                      n, shift, counts.data())
+        : radix_sort_pass<Descending>(for_each_block, num_blocks,
+                                      keys, vals, key_buf, val_buf,
+                                      n, shift, counts.data());
+    if (moved) {
+      in_buf = !in_buf;
+    }
+  }
+
+  if (in_buf) {
+    for_each_block(num_blocks, [=](diff_type block) {
+      const diff_type i_end = firstIndex(n, num_blocks, block + 1);
+      for (diff_type i = firstIndex(n, num_blocks, block); i < i_end; ++i) {
+        keys[i] = key_buf[i];
+        vals[i] = val_buf[i];
+      }
+    });
+  }
+}
+
+/*!
+    \brief stable LSD radix sort of arithmetic keys in the order given by
+    RAJA::operators::less or RAJA::operators::greater
+
+    See radix_sort_impl for the meaning of for_each_block and num_blocks.
+*/
+template <typename ForEachBlock, typename Iter, typename Compare>
+RAJA_INLINE
+void
+radix_sort(ForEachBlock&& for_each_block,
+           RAJA::detail::IterDiff<Iter> num_blocks,
+           Iter begin,
+           Iter end,
+           Compare)
+{
+  using key_type = RAJA::detail::IterVal<Iter>;
+  constexpr bool descending =
+      std::is_same<Compare, operators::greater<key_type>>::value;
+
+  const RAJA::detail::IterDiff<Iter> n = end - begin;
+  if (n <= 1) {
+    return;
+  }
+
+  auto key_buf = radix_allocate<key_type>(n);
+
+  radix_sort_impl<descending>(for_each_block, num_blocks,
+                              begin, radix_no_vals{},
+                              key_buf.get(), radix_no_vals{},
+                              n);
+}
+
+/*!
+    \brief stable LSD radix sort of arithmetic keys and their values in the
+    order given by RAJA::operators::less or RAJA::operators::greater
+
+    See radix_sort_impl for the meaning of for_each_block and num_blocks.
+*/
+template <typename ForEachBlock, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+void
+radix_sort_pairs(ForEachBlock&& for_each_block,
+                 RAJA::detail::IterDiff<KeyIter> num_blocks,
+                 KeyIter keys_begin,
+                 KeyIter keys_end,
+                 ValIter vals_begin,
+                 Compare)
+{
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+  using val_type = RAJA::detail::IterVal<ValIter>;
+  constexpr bool descending =
+      std::is_same<Compare, operators::greater<key_type>>::value;
+
+  const RAJA::detail::IterDiff<KeyIter> n = keys_end - keys_begin;
+  if (n <= 1) {
+    return;
+  }
+
+  auto key_buf = radix_allocate<key_type>(n);
+  auto val_buf = radix_allocate<val_type>(n);
+
+  radix_sort_impl<descending>(for_each_block, num_blocks,
+                              keys_begin, vals_begin,
+                              key_buf.get(), val_buf.get(),
+                              n);
+}
+
 }  // namespace detail
 
 /*!
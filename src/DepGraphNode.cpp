@@ -15,11 +15,18 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include <climits>
 #include <iostream>
 #include <string>
 
 #include "RAJA/internal/DepGraphNode.hpp"
 
+#if defined(RAJA_HAVE_FUTEX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace RAJA
 {
 
@@ -39,4 +46,40 @@ void DepGraphNode::print(std::ostream& os) const
   os << std::endl;
 }
 
+void DepGraphNode::park(int expected)
+{
+#if defined(RAJA_HAVE_FUTEX)
+  static_assert(sizeof(std::atomic<int>) == sizeof(int),
+                "futex requires lock-free std::atomic<int>");
+  syscall(SYS_futex,
+          reinterpret_cast<int*>(&m_semaphore_value),
+          FUTEX_WAIT_PRIVATE,
+          expected,
+          nullptr,
+          nullptr,
+          0);
+#elif defined(__cpp_lib_atomic_wait)
+  m_semaphore_value.wait(expected);
+#else
+  // no blocking primitive available, fall back to yielding
+  (void)expected;
+  std::this_thread::yield();
+#endif
+}
+
+void DepGraphNode::unpark()
+{
+#if defined(RAJA_HAVE_FUTEX)
+  syscall(SYS_futex,
+          reinterpret_cast<int*>(&m_semaphore_value),
+          FUTEX_WAKE_PRIVATE,
+          INT_MAX,
+          nullptr,
+          nullptr,
+          0);
+#elif defined(__cpp_lib_atomic_wait)
+  m_semaphore_value.notify_all();
+#endif
+}
+
 }  // namespace RAJA
@@ -59,14 +59,19 @@ KokkosPluginLoader::KokkosPluginLoader()
 
 void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
+  // reading a reducer is not a kernel as far as Kokkos tools are concerned
+  if (p.pattern == PluginPattern::reduce) return;
+
   for (auto &func : pre_functions)
   {
-    func("", 0, &(p.kID));
+    func(p.kernel_name ? p.kernel_name : "", 0, &(p.kID));
   }
 }
 
 void KokkosPluginLoader::postLaunch(const RAJA::util::PluginContext& p)
 {
+  if (p.pattern == PluginPattern::reduce) return;
+
   for (auto &func : post_functions)
   {
     func(p.kID);
@@ -107,85 +107,67 @@ void buildLockFreeBlockIndexset(
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::Index_type startPlane = i * slowDim / numThreads;
-              RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
-              RAJA::Index_type start = startPlane * fastDim * midDim;
-              RAJA::Index_type end = endPlane * fastDim * midDim;
-              RAJA::Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
+    /* Need at least one full plane per segment; each thread owns */
+    /* a contiguous block of planes split into segmentsPerThread */
+    /* segments. */
+    const int segmentsPerThread = 2;
+    int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
+    if (rowsPerSegment == 0) {
+      /* Not enough planes to divide the mesh, so fall back to a */
+      /* single segment, which trivially has no dependencies. */
+      // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
+      iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
 
-          iset.finalizeDependencyGraph();
+      iset.initDependencyGraph();
+      iset.finalizeDependencyGraph();
+    } else {
+      /* Segment (lane * numThreads + i) holds the lane-th part of the */
+      /* block of planes owned by thread i. With omp schedule(static, 1) */
+      /* thread i therefore executes its lanes in increasing plane order. */
+      for (int lane = 0; lane < segmentsPerThread; ++lane) {
+        for (int i = 0; i < numThreads; ++i) {
+          RAJA::Index_type startPlane = i * slowDim / numThreads;
+          RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
+          RAJA::Index_type start = startPlane * fastDim * midDim;
+          RAJA::Index_type end = endPlane * fastDim * midDim;
+          RAJA::Index_type len = end - start;
+          // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
+          //                   start + (lane+1)*len/segmentsPerThread  );
+          iset.push_back(
+              RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
+                                 start + (lane + 1) * len /
+                                             segmentsPerThread));
+        }
+      }
+
+      /* Allocate dependency graph structures for index set segments */
+      iset.initDependencyGraph();
+
+      /* The last segment of thread i borders the first segment of */
+      /* thread i below it and the first segment of thread i+1 above */
+      /* it, so it must run after both (only the first for the last */
+      /* thread). First segments have no dependencies, so every pair */
+      /* of neighboring segments is ordered, which also makes the graph */
+      /* valid for dep_graph::release_inline. Every segment only waits */
+      /* on segments with a lower id, which is deadlock-free with omp */
+      /* schedule(static, 1). */
+      int borderSeg = numThreads * (segmentsPerThread - 1);
+      for (int i = 0; i < numThreads; ++i) {
+        RAJA::DepGraphNode* task = iset.getDepGraphNode(i);
+        task->numDepTasks() = (i > 0) ? 2 : 1;
+        task->depTaskNum(0) = borderSeg + i;
+        if (i > 0) {
+          task->depTaskNum(1) = borderSeg + i - 1;
         }
-    */
+
+        RAJA::DepGraphNode* border_task = iset.getDepGraphNode(borderSeg + i);
+        const int num_preds = (i < numThreads - 1) ? 2 : 1;
+        border_task->semaphoreValue() = num_preds;
+        border_task->semaphoreReloadValue() = num_preds;
+      }
+
+      iset.finalizeDependencyGraph();
+    }
   }
 
   /* Print the dependency schedule for segments */
@@ -12,7 +12,13 @@ RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 namespace RAJA {
 namespace util {
 
-PluginStrategy::PluginStrategy() = default;
+namespace detail {
+
+bool plugins_created = false;
+
+} // closing brace for detail namespace
+
+PluginStrategy::PluginStrategy() { detail::plugins_created = true; }
 
 void PluginStrategy::init(const PluginOptions&) { }
 
@@ -0,0 +1,19 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Shared library exposing ProfilerPlugin to RuntimePluginLoader, e.g.
+//
+//   RAJA_PLUGINS=<prefix>/lib/libRAJA_profiler_plugin.so ./app
+//
+
+#include "RAJA/util/ProfilerPlugin.hpp"
+
+extern "C" RAJA::util::PluginStrategy *getPlugin()
+{
+  return new RAJA::util::ProfilerPlugin;
+}
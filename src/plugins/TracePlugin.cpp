@@ -0,0 +1,19 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Shared library exposing TracePlugin to RuntimePluginLoader, e.g.
+//
+//   RAJA_PLUGINS=<prefix>/lib/libRAJA_trace_plugin.so ./app
+//
+
+#include "RAJA/util/TracePlugin.hpp"
+
+extern "C" RAJA::util::PluginStrategy *getPlugin()
+{
+  return new RAJA::util::TracePlugin;
+}
@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for lock-free index set builders and
+/// dependency graph (taskgraph) index set traversal.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(IndexSetBuild, LockFreeBlock3D)
+{
+  const int fastDim = 4;
+  const int midDim = 3;
+  const int slowDim = 64;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  ASSERT_EQ(iset.getLength(),
+            static_cast<size_t>(fastDim * midDim * slowDim));
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  // forward dependencies must refer to valid segments
+  for (size_t segid = 0; segid < iset.getNumSegments(); ++segid) {
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(segid);
+    ASSERT_NE(task, nullptr);
+    for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+      ASSERT_GE(task->depTaskNum(ii), 0);
+      ASSERT_LT(task->depTaskNum(ii), static_cast<int>(iset.getNumSegments()));
+    }
+  }
+
+  // dependency graph is deep copied with the index set
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset_copy(iset);
+  ASSERT_TRUE(iset_copy.dependencyGraphSet());
+  ASSERT_NE(iset_copy.getDepGraphNode(0), iset.getDepGraphNode(0));
+  for (size_t segid = 0; segid < iset.getNumSegments(); ++segid) {
+    ASSERT_EQ(iset_copy.getDepGraphNode(segid)->numDepTasks(),
+              iset.getDepGraphNode(segid)->numDepTasks());
+    ASSERT_EQ(iset_copy.getDepGraphNode(segid)->semaphoreReloadValue(),
+              iset.getDepGraphNode(segid)->semaphoreReloadValue());
+  }
+}
+
+TEST(IndexSetBuild, DepGraphNodeSatisfy)
+{
+  RAJA::DepGraphNode node;
+  node.semaphoreReloadValue() = 2;
+  node.reset();
+
+  ASSERT_FALSE(node.satisfyOne());
+  ASSERT_TRUE(node.satisfyOne());
+  ASSERT_EQ(node.semaphoreValue().load(), 0);
+
+  // extra satisfies never release the node again
+  ASSERT_FALSE(node.satisfyOne());
+  ASSERT_EQ(node.semaphoreValue().load(), 0);
+
+  node.wait(RAJA::dep_graph::spin_wait{});
+  node.wait(RAJA::dep_graph::park_wait<>{});
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+// one contiguous interval of segments per thread, for the interval policies
+void setThreadIntervals(RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+                        int num_threads)
+{
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  for (int t = 0; t < num_threads; ++t) {
+    iset.setSegmentInterval(t,
+                            t * num_seg / num_threads,
+                            (t + 1) * num_seg / num_threads);
+  }
+}
+
+template <typename SEG_IT_POL>
+void testLockFreeBlock3DTaskgraph()
+{
+  const int fastDim = 8;
+  const int midDim = 8;
+  const int slowDim = 128;
+  const int len = fastDim * midDim * slowDim;
+
+  // need several threads for neighboring segments to have a chance to overlap
+  const int prev_threads = omp_get_max_threads();
+  omp_set_num_threads(prev_threads < 4 ? 4 : prev_threads);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+  setThreadIntervals(iset, omp_get_max_threads());
+
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  ASSERT_GT(num_seg, 1);
+  const int num_threads = num_seg / 2;
+
+  std::vector<int> seg_of(len, -1);
+  for (int seg = 0; seg < num_seg; ++seg) {
+    auto const& range = iset.getSegment<RAJA::RangeSegment>(seg);
+    for (auto i : range) {
+      seg_of[i] = seg;
+    }
+  }
+  for (int i = 0; i < len; ++i) {
+    ASSERT_GE(seg_of[i], 0);
+  }
+
+  std::vector<int> count(len, 0);
+  std::vector<long> start(len), finish(len);
+  int* count_ptr = count.data();
+  long* start_ptr = start.data();
+  long* finish_ptr = finish.data();
+  int const* seg_of_ptr = seg_of.data();
+  std::atomic<long> clock(0);
+  std::atomic<long>* clock_ptr = &clock;
+
+  using EXEC_POL = RAJA::ExecPolicy<SEG_IT_POL, RAJA::seq_exec>;
+
+  // graph is reset after each segment, so it can be traversed repeatedly
+  const int num_sweeps = 3;
+  for (int sweep = 0; sweep < num_sweeps; ++sweep) {
+    RAJA::forall<EXEC_POL>(iset, [=](RAJA::Index_type i) {
+      start_ptr[i] = (*clock_ptr)++;
+      count_ptr[i] += 1;
+
+      // segments of even threads yield once per row, so threads interleave
+      // even on a single core and an odd thread finishing its first
+      // segment early would overlap any unordered neighbor
+      const int owner = seg_of_ptr[i] % num_threads;
+      if (owner % 2 == 0 && i % fastDim == 0) {
+        std::this_thread::yield();
+      }
+
+      finish_ptr[i] = (*clock_ptr)++;
+    });
+
+    // the execution intervals of segments sharing a boundary must not
+    // overlap
+    std::vector<long> seg_start(num_seg, clock.load());
+    std::vector<long> seg_finish(num_seg, -1);
+    for (int i = 0; i < len; ++i) {
+      const int seg = seg_of[i];
+      seg_start[seg] = std::min(seg_start[seg], start[i]);
+      seg_finish[seg] = std::max(seg_finish[seg], finish[i]);
+    }
+    for (int i = 1; i < len; ++i) {
+      const int a = seg_of[i - 1];
+      const int b = seg_of[i];
+      if (a != b) {
+        ASSERT_TRUE(seg_finish[a] < seg_start[b] ||
+                    seg_finish[b] < seg_start[a])
+            << "segments " << a << " and " << b << " overlapped";
+      }
+    }
+  }
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(count[i], num_sweeps);
+  }
+
+  omp_set_num_threads(prev_threads);
+}
+
+template <typename SEG_IT_POL>
+void testTaskgraphSerialChain()
+{
+  const int num_seg = 16;
+  const int seg_len = 10;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  // chain: segment s can only run after segment s-1
+  iset.initDependencyGraph();
+  for (int s = 0; s < num_seg; ++s) {
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(s);
+    task->semaphoreValue() = (s == 0) ? 0 : 1;
+    task->semaphoreReloadValue() = (s == 0) ? 0 : 1;
+    if (s != num_seg - 1) {
+      task->numDepTasks() = 1;
+      task->depTaskNum(0) = s + 1;
+    }
+  }
+  iset.finalizeDependencyGraph();
+  setThreadIntervals(iset, omp_get_max_threads());
+
+  for (int sweep = 0; sweep < 2; ++sweep) {
+    std::vector<int> order(num_seg * seg_len, -1);
+    int* order_ptr = order.data();
+    std::atomic<int> counter(0);
+    std::atomic<int>* counter_ptr = &counter;
+
+    RAJA::forall<RAJA::ExecPolicy<SEG_IT_POL, RAJA::seq_exec>>(
+        iset, [=](RAJA::Index_type i) { order_ptr[i] = (*counter_ptr)++; });
+
+    for (int i = 0; i < num_seg * seg_len; ++i) {
+      ASSERT_EQ(order[i], i);
+    }
+  }
+}
+
+TEST(IndexSetBuild, LockFreeBlock3DTaskgraph)
+{
+  testLockFreeBlock3DTaskgraph<RAJA::omp_taskgraph_segit>();
+  testLockFreeBlock3DTaskgraph<
+      RAJA::omp_taskgraph_wait_segit<RAJA::dep_graph::spin_wait>>();
+  testLockFreeBlock3DTaskgraph<
+      RAJA::omp_taskgraph_wait_segit<RAJA::dep_graph::park_wait<>>>();
+  testLockFreeBlock3DTaskgraph<
+      RAJA::omp_taskgraph_wait_segit<RAJA::dep_graph::release_inline>>();
+  testLockFreeBlock3DTaskgraph<
+      RAJA::omp_taskgraph_interval_wait_segit<RAJA::dep_graph::spin_wait>>();
+  testLockFreeBlock3DTaskgraph<
+      RAJA::omp_taskgraph_interval_wait_segit<RAJA::dep_graph::park_wait<>>>();
+}
+
+TEST(IndexSetBuild, TaskgraphSerialChain)
+{
+  testTaskgraphSerialChain<RAJA::omp_taskgraph_segit>();
+  testTaskgraphSerialChain<
+      RAJA::omp_taskgraph_wait_segit<RAJA::dep_graph::park_wait<16>>>();
+  testTaskgraphSerialChain<
+      RAJA::omp_taskgraph_wait_segit<RAJA::dep_graph::release_inline>>();
+  testTaskgraphSerialChain<
+      RAJA::omp_taskgraph_interval_wait_segit<RAJA::dep_graph::park_wait<16>>>();
+  testTaskgraphSerialChain<
+      RAJA::omp_taskgraph_interval_wait_segit<
+          RAJA::dep_graph::release_inline>>();
+}
+
+TEST(IndexSetBuild, TaskgraphIntervalsMustCoverSegments)
+{
+  using EXEC_POL = RAJA::ExecPolicy<
+      RAJA::omp_taskgraph_interval_wait_segit<RAJA::dep_graph::spin_wait>,
+      RAJA::seq_exec>;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, 4, 3, 64);
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  const int num_threads = omp_get_max_threads();
+
+  std::vector<int> count(iset.getLength(), 0);
+  int* count_ptr = count.data();
+  auto body = [=](RAJA::Index_type i) { count_ptr[i] += 1; };
+
+  // the builder sets no intervals
+  EXPECT_THROW(RAJA::forall<EXEC_POL>(iset, body), std::runtime_error);
+
+  // a gap between the intervals
+  iset.setSegmentInterval(0, 0, num_seg / 2);
+  iset.setSegmentInterval(1, num_seg / 2 + 1, num_seg);
+  EXPECT_THROW(RAJA::forall<EXEC_POL>(iset, body), std::runtime_error);
+
+  // more intervals than threads
+  setThreadIntervals(iset, num_threads + 1);
+  EXPECT_THROW(RAJA::forall<EXEC_POL>(iset, body), std::runtime_error);
+
+  for (int c : count) {
+    ASSERT_EQ(c, 0);
+  }
+}
+#endif
@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_HYPERPLANE_HPP__
+#define __TEST_KERNEL_HYPERPLANE_HPP__
+
+//
+// Each point is set to one more than the largest of its neighbors below it
+// along every index, which gives i + j + k + 1 only if all of them were
+// already computed. Every point must also be visited exactly once.
+//
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelHyperplane2DTestImpl(INDEX_TYPE first, INDEX_TYPE N, INDEX_TYPE M)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  INDEX_TYPE* work_value = work_res.allocate<INDEX_TYPE>(N * M);
+  INDEX_TYPE* work_visits = work_res.allocate<INDEX_TYPE>(N * M);
+  INDEX_TYPE* check_value = host_res.allocate<INDEX_TYPE>(N * M);
+  INDEX_TYPE* check_visits = host_res.allocate<INDEX_TYPE>(N * M);
+
+  work_res.memset(work_value, 0, sizeof(INDEX_TYPE) * N * M);
+  work_res.memset(work_visits, 0, sizeof(INDEX_TYPE) * N * M);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(first, first + N),
+                     RAJA::TypedRangeSegment<INDEX_TYPE>(first, first + M)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j) {
+      const INDEX_TYPE ii = i - first;
+      const INDEX_TYPE jj = j - first;
+      INDEX_TYPE value = 0;
+      if (ii > 0 && work_value[(ii - 1) * M + jj] > value) {
+        value = work_value[(ii - 1) * M + jj];
+      }
+      if (jj > 0 && work_value[ii * M + jj - 1] > value) {
+        value = work_value[ii * M + jj - 1];
+      }
+      work_value[ii * M + jj] = value + 1;
+      work_visits[ii * M + jj] += 1;
+    }
+
+  );
+
+  work_res.memcpy(check_value, work_value, sizeof(INDEX_TYPE) * N * M);
+  work_res.memcpy(check_visits, work_visits, sizeof(INDEX_TYPE) * N * M);
+
+  for (INDEX_TYPE i = 0; i < N; ++i) {
+    for (INDEX_TYPE j = 0; j < M; ++j) {
+      ASSERT_EQ(check_value[i * M + j], i + j + 1);
+      ASSERT_EQ(check_visits[i * M + j], 1);
+    }
+  }
+
+  work_res.deallocate(work_value);
+  work_res.deallocate(work_visits);
+  host_res.deallocate(check_value);
+  host_res.deallocate(check_visits);
+}
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void KernelHyperplane3DTestImpl(INDEX_TYPE first,
+                                INDEX_TYPE N,
+                                INDEX_TYPE M,
+                                INDEX_TYPE P)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE size = N * M * P;
+
+  INDEX_TYPE* work_value = work_res.allocate<INDEX_TYPE>(size);
+  INDEX_TYPE* work_visits = work_res.allocate<INDEX_TYPE>(size);
+  INDEX_TYPE* check_value = host_res.allocate<INDEX_TYPE>(size);
+  INDEX_TYPE* check_visits = host_res.allocate<INDEX_TYPE>(size);
+
+  work_res.memset(work_value, 0, sizeof(INDEX_TYPE) * size);
+  work_res.memset(work_visits, 0, sizeof(INDEX_TYPE) * size);
+
+  RAJA::kernel<EXEC_POLICY>(
+
+    RAJA::make_tuple(RAJA::TypedRangeSegment<INDEX_TYPE>(first, first + N),
+                     RAJA::TypedRangeSegment<INDEX_TYPE>(first, first + M),
+                     RAJA::TypedRangeSegment<INDEX_TYPE>(first, first + P)),
+
+    [=] (INDEX_TYPE i, INDEX_TYPE j, INDEX_TYPE k) {
+      const INDEX_TYPE ii = i - first;
+      const INDEX_TYPE jj = j - first;
+      const INDEX_TYPE kk = k - first;
+      const INDEX_TYPE idx = (ii * M + jj) * P + kk;
+      INDEX_TYPE value = 0;
+      if (ii > 0 && work_value[idx - M * P] > value) {
+        value = work_value[idx - M * P];
+      }
+      if (jj > 0 && work_value[idx - P] > value) {
+        value = work_value[idx - P];
+      }
+      if (kk > 0 && work_value[idx - 1] > value) {
+        value = work_value[idx - 1];
+      }
+      work_value[idx] = value + 1;
+      work_visits[idx] += 1;
+    }
+
+  );
+
+  work_res.memcpy(check_value, work_value, sizeof(INDEX_TYPE) * size);
+  work_res.memcpy(check_visits, work_visits, sizeof(INDEX_TYPE) * size);
+
+  for (INDEX_TYPE i = 0; i < N; ++i) {
+    for (INDEX_TYPE j = 0; j < M; ++j) {
+      for (INDEX_TYPE k = 0; k < P; ++k) {
+        ASSERT_EQ(check_value[(i * M + j) * P + k], i + j + k + 1);
+        ASSERT_EQ(check_visits[(i * M + j) * P + k], 1);
+      }
+    }
+  }
+
+  work_res.deallocate(work_value);
+  work_res.deallocate(work_visits);
+  host_res.deallocate(check_value);
+  host_res.deallocate(check_visits);
+}
+
+
+TYPED_TEST_SUITE_P(KernelHyperplane2DTest);
+template <typename T>
+class KernelHyperplane2DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(KernelHyperplane3DTest);
+template <typename T>
+class KernelHyperplane3DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelHyperplane2DTest, HyperplaneKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelHyperplane2DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(0, 1, 1);
+  KernelHyperplane2DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(0, 37, 53);
+  KernelHyperplane2DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(3, 64, 5);
+}
+
+TYPED_TEST_P(KernelHyperplane3DTest, HyperplaneKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  KernelHyperplane3DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(0, 1, 1, 1);
+  KernelHyperplane3DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(0, 13, 7, 21);
+  KernelHyperplane3DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(2, 5, 17, 3);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelHyperplane2DTest,
+                            HyperplaneKernel);
+
+REGISTER_TYPED_TEST_SUITE_P(KernelHyperplane3DTest,
+                            HyperplaneKernel);
+
+#endif  // __TEST_KERNEL_HYPERPLANE_HPP__
@@ -8,6 +8,7 @@
 #ifndef __NESTED_LOOP_MULTI_LAMBDA_PARAM_REDUCE_SUM_IMPL_HPP__
 #define __NESTED_LOOP_MULTI_LAMBDA_PARAM_REDUCE_SUM_IMPL_HPP__
 
+#include <algorithm>
 #include <numeric>
 
 template<typename EXEC_POL, bool USE_RESOURCE,
@@ -35,6 +36,9 @@ typename std::enable_if< !USE_RESOURCE >::type call_kernel(SEGMENTS&& segs, PARA
 //
 using BlockReduceSumSupportedLoopTypeList = camp::list<
   DEPTH_1_REDUCESUM,
+  DEPTH_1_REDUCESUM_ENCLOSED_LOOP,
+  DEPTH_1_REDUCESUM_REGION,
+  DEPTH_2_REDUCESUM_REGION,
   DEVICE_DEPTH_1_REDUCESUM
   >;
 
@@ -82,7 +86,7 @@ void KernelNestedLoopTest(const DEPTH_1_REDUCESUM&, const int N){
        value = work_array[i];
     },
 
-    // lambda 1, only runs for device
+    // lambda 1, only runs for device, region and enclosed loop policies
     [=] RAJA_HOST_DEVICE (RAJA::Index_type i, int & value) {
        value += work_array[i];
     },
@@ -109,6 +113,97 @@ void KernelNestedLoopTest(const DEVICE_DEPTH_1_REDUCESUM&, Args... args){
   KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RESOURCE>(DEPTH_1_REDUCESUM(), args...);
 }
 
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL, bool USE_RESOURCE, typename... Args>
+void KernelNestedLoopTest(const DEPTH_1_REDUCESUM_ENCLOSED_LOOP&, Args... args){
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RESOURCE>(DEPTH_1_REDUCESUM(), args...);
+}
+
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL, bool USE_RESOURCE, typename... Args>
+void KernelNestedLoopTest(const DEPTH_1_REDUCESUM_REGION&, Args... args){
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RESOURCE>(DEPTH_1_REDUCESUM(), args...);
+}
+
+//
+// The region reduces every row of a 2D range, so the reduction executes
+// once per row.
+//
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL, bool USE_RESOURCE>
+void KernelNestedLoopTest(const DEPTH_2_REDUCESUM_REGION&, const int N){
+
+  constexpr int ROWS = 100;
+
+  WORKING_RES work_res{WORKING_RES::get_default()};
+  camp::resources::Resource erased_work_res{work_res};
+
+  // Allocate Tests Data
+  int * work_array;
+  int * check_array;
+  int * test_array;
+
+  allocateForallTestData<int>(N,
+                              erased_work_res,
+                              &work_array,
+                              &check_array,
+                              &test_array);
+
+  int * work_rows;
+  int * check_rows;
+  int * test_rows;
+
+  allocateForallTestData<int>(ROWS,
+                              erased_work_res,
+                              &work_rows,
+                              &check_rows,
+                              &test_rows);
+
+  // Initialize Data
+  std::iota(test_array, test_array + RAJA::stripIndexType(N), 0);
+  std::fill(test_rows, test_rows + ROWS, 0);
+
+  erased_work_res.memcpy(work_array, test_array, sizeof(int) * RAJA::stripIndexType(N));
+  erased_work_res.memcpy(work_rows, test_rows, sizeof(int) * ROWS);
+
+  // Calculate Working data
+  call_kernel<EXEC_POLICY, USE_RESOURCE>(
+    RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, ROWS)),
+    RAJA::make_tuple<int>(0),
+
+    // Resource
+    work_res,
+
+    // lambda 0, unused
+    [=] RAJA_HOST_DEVICE (RAJA::Index_type, RAJA::Index_type, int &) {},
+
+    // lambda 1, every thread accumulates its share of the row
+    [=] RAJA_HOST_DEVICE (RAJA::Index_type i, RAJA::Index_type j, int & value) {
+       value += work_array[i] + j;
+    },
+
+    // lambda 2, only gets executed on the thread which received the reduced
+    // value of the row
+    [=] RAJA_HOST_DEVICE (RAJA::Index_type j, int & value) {
+       work_rows[j] += value;
+    }
+
+  );
+
+  erased_work_res.memcpy(check_rows, work_rows, sizeof(int) * ROWS);
+
+  for (int j = 0; j < ROWS; ++j) {
+    ASSERT_EQ(check_rows[j], N*(N-1)/2 + N*j);
+  }
+
+  deallocateForallTestData<int>(erased_work_res,
+                                work_rows,
+                                check_rows,
+                                test_rows);
+
+  deallocateForallTestData<int>(erased_work_res,
+                                work_array,
+                                check_array,
+                                test_array);
+}
+
 //
 //
 // Defining the Kernel Loop structure for Block Nested Loop Tests.
@@ -129,6 +224,52 @@ struct BlockNestedLoopExec<DEPTH_1_REDUCESUM, REDUCE_POL, POLICY_DATA> {
     >;
 };
 
+// The loop sits inside the reduction, which combines the values of its
+// ranges once the loop is done.
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockNestedLoopExec<DEPTH_1_REDUCESUM_ENCLOSED_LOOP, REDUCE_POL, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::operators::plus, RAJA::statement::Param<0>,
+        RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<0>>::type, RAJA::statement::Lambda<1>>,
+        RAJA::statement::Lambda<2, RAJA::Params<0>>
+      >
+    >;
+};
+
+// Every thread of the region accumulates its share of the loop and the
+// values are reduced across the threads; Lambda 2 only gets executed on the
+// thread which received the reduced value.
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockNestedLoopExec<DEPTH_1_REDUCESUM_REGION, REDUCE_POL, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::Region<typename camp::at<POLICY_DATA, camp::num<0>>::type,
+        RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::statement::Lambda<1>>,
+        RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<2>>::type, RAJA::operators::plus, RAJA::statement::Param<0>,
+          RAJA::statement::Lambda<2, RAJA::Params<0>>
+        >
+      >
+    >;
+};
+
+// Every thread of the region walks all the rows; the loop over each row is
+// shared by the threads and reduced before the next row starts.
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockNestedLoopExec<DEPTH_2_REDUCESUM_REGION, REDUCE_POL, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::Region<typename camp::at<POLICY_DATA, camp::num<0>>::type,
+        RAJA::statement::For<1, RAJA::loop_exec,
+          RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::statement::Lambda<1>>,
+          RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<2>>::type, RAJA::operators::plus, RAJA::statement::Param<0>,
+            RAJA::statement::Lambda<2, RAJA::Segs<1>, RAJA::Params<0>>
+          >
+        >
+      >
+    >;
+};
+
 #if defined(RAJA_ENABLE_CUDA) or defined(RAJA_ENABLE_HIP)
 
 template<typename REDUCE_POL, typename POLICY_DATA>
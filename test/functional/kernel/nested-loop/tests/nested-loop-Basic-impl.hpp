@@ -38,6 +38,7 @@ using BasicSupportedLoopTypeList = camp::list<
   DEPTH_3_COLLAPSE,
   DEPTH_3_COLLAPSE_SEQ_INNER,
   DEPTH_3_COLLAPSE_SEQ_OUTER,
+  DEPTH_4_COLLAPSE,
   DEVICE_DEPTH_2>;
 
 //
@@ -166,6 +167,58 @@ void KernelNestedLoopTest(const DEPTH_3_COLLAPSE_SEQ_INNER&, Args... args){
   KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, USE_RESOURCE>(DEPTH_3(), args...);
 }
 
+//
+//
+// Basic 4D Matrix index calculation per element, with a short outer loop.
+//
+//
+template <typename WORKING_RES, typename EXEC_POLICY, bool USE_RESOURCE>
+void KernelNestedLoopTest(const DEPTH_4_COLLAPSE&,
+                          const RAJA::Index_type dim0,
+                          const RAJA::Index_type dim1,
+                          const RAJA::Index_type dim2){
+  WORKING_RES work_res{WORKING_RES::get_default()};
+  camp::resources::Resource erased_work_res{work_res};
+
+  const RAJA::Index_type dim3 = 3;
+  RAJA::Index_type flatSize = dim0 * dim1 * dim2 * dim3;
+  RAJA::Index_type* work_array;
+  RAJA::Index_type* check_array;
+  RAJA::Index_type* test_array;
+
+  allocateForallTestData<RAJA::Index_type>(flatSize,
+                                     erased_work_res,
+                                     &work_array,
+                                     &check_array,
+                                     &test_array);
+
+  RAJA::TypedRangeSegment<RAJA::Index_type> rangeflat(0,flatSize);
+  RAJA::TypedRangeSegment<RAJA::Index_type> range0(0, dim0);
+  RAJA::TypedRangeSegment<RAJA::Index_type> range1(0, dim1);
+  RAJA::TypedRangeSegment<RAJA::Index_type> range2(0, dim2);
+  RAJA::TypedRangeSegment<RAJA::Index_type> range3(0, dim3);
+
+  std::iota(test_array, test_array + RAJA::stripIndexType(flatSize), 0);
+
+  constexpr int Depth = 4;
+  RAJA::View< RAJA::Index_type, RAJA::Layout<Depth> > work_view(work_array, dim3, dim2, dim1, dim0);
+
+  call_kernel<EXEC_POLICY, USE_RESOURCE>(RAJA::make_tuple(range3, range2, range1, range0), work_res,
+                            [=] RAJA_HOST_DEVICE (RAJA::Index_type l, RAJA::Index_type k, RAJA::Index_type j, RAJA::Index_type i) {
+                              work_view(l,k,j,i) = (dim0 * dim1 * dim2 * l) + (dim0 * dim1 * k) + (dim0 * j) + i;
+                            });
+
+  work_res.memcpy(check_array, work_array, sizeof(RAJA::Index_type) * RAJA::stripIndexType(flatSize));
+  RAJA::forall<RAJA::seq_exec>(rangeflat, [=] (RAJA::Index_type i) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  });
+
+  deallocateForallTestData<RAJA::Index_type>(erased_work_res,
+                                       work_array,
+                                       check_array,
+                                       test_array);
+}
+
 //
 //
 // Defining the Kernel Loop structure for Basic Nested Loop Tests.
@@ -222,6 +275,17 @@ struct BasicNestedLoopExec<DEPTH_3_COLLAPSE, POLICY_DATA> {
     >;
 };
 
+template<typename POLICY_DATA>
+struct BasicNestedLoopExec<DEPTH_4_COLLAPSE, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::Collapse< typename camp::at<POLICY_DATA, camp::num<0>>::type,
+        RAJA::ArgList<0,1,2,3>,
+        RAJA::statement::Lambda<0>
+      >
+    >;
+};
+
 template<typename POLICY_DATA>
 struct BasicNestedLoopExec<DEPTH_3_COLLAPSE_SEQ_OUTER, POLICY_DATA> {
   using type = 
@@ -37,6 +37,7 @@ using OpenMPForallExecPols =
  
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
+              , RAJA::omp_lookback_scan_exec<64>
 
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_for_dynamic_exec< >
@@ -102,7 +103,8 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_static< 2 >,
                                       RAJA::tbb_for_static< 4 >,
                                       RAJA::tbb_for_static< 8 >,
-                                      RAJA::tbb_for_dynamic >;
+                                      RAJA::tbb_for_dynamic,
+                                      RAJA::tbb_lookback_scan_exec< 64 > >;
 
 using TBBForallReduceExecPols = TBBForallExecPols;
 
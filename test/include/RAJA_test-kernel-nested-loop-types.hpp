@@ -15,12 +15,16 @@
 #endif
 
 struct DEPTH_1_REDUCESUM {};
+struct DEPTH_1_REDUCESUM_ENCLOSED_LOOP {};
+struct DEPTH_1_REDUCESUM_REGION {};
+struct DEPTH_2_REDUCESUM_REGION {};
 struct DEPTH_2 {};
 struct DEPTH_2_COLLAPSE {};
 struct DEPTH_3 {};
 struct DEPTH_3_COLLAPSE {};
 struct DEPTH_3_COLLAPSE_SEQ_INNER {};
 struct DEPTH_3_COLLAPSE_SEQ_OUTER {};
+struct DEPTH_4_COLLAPSE {};
 struct DEPTH_3_REDUCESUM {};
 struct DEPTH_3_REDUCESUM_SEQ_INNER {};
 struct DEPTH_3_REDUCESUM_SEQ_OUTER {};
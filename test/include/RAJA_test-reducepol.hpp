@@ -16,7 +16,8 @@
 #include "camp/list.hpp"
 
 // Sequential reduction policy types
-using SequentialReducePols = camp::list< RAJA::seq_reduce >;
+using SequentialReducePols = camp::list< RAJA::seq_reduce,
+                                         RAJA::seq_reduce_reproducible >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducePols = 
@@ -24,12 +25,15 @@ using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
               RAJA::omp_reduce_ordered >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::omp_reduce_padded,
+              RAJA::omp_reduce_reproducible >;
 #endif
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
-using TBBReducePols = camp::list< RAJA::tbb_reduce >;
+using TBBReducePols = camp::list< RAJA::tbb_reduce,
+                                  RAJA::tbb_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -343,7 +343,13 @@ using OpenMPExecPolicyList =
                 RAJA::omp_work
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_flatten_chunk_dynamic<>,
+                RAJA::unordered_omp_flatten_chunk_dynamic<1>
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
@@ -54,6 +54,9 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, RAJA::Platform::undefined);
     data.launch_counter_pre++;
     data.launch_platform_active = p.platform;
+    data.launch_kernel_name = p.kernel_name;
+    data.launch_num_iterations = p.num_iterations;
+    data.launch_pattern = p.pattern;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -68,6 +71,7 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, p.platform);
     data.launch_counter_post++;
     data.launch_platform_active = RAJA::Platform::undefined;
+    data.launch_imbalance = p.imbalance;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
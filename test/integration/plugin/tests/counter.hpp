@@ -16,6 +16,10 @@ struct CounterData
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  const char*    launch_kernel_name     = nullptr;
+  std::size_t    launch_num_iterations  = 0;
+  RAJA::util::PluginPattern launch_pattern = RAJA::util::PluginPattern::undefined;
+  RAJA::util::LoadImbalance launch_imbalance{};
 };
 
 // note the use of a pointer here to allow different types of memory
@@ -191,6 +191,53 @@ void PluginForAllIcountIdxSetTestImpl()
 
   plugin_test_resource->deallocate(data);
 }
+// test the context passed to plugins with named and unnamed forall
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginForAllNamedTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  const char* name = "PluginForAllNamed";
+
+  RAJA::forall<ExecPolicy>(
+    RAJA::KernelName(name),
+    RAJA::RangeSegment(0,10),
+    PluginTestCallable{data}
+  );
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_STREQ(plugin_data.launch_kernel_name,  name);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  10u);
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::forall);
+
+  // only OpenMP parallel loops are measured, never more iterations than ran
+  ASSERT_LE(plugin_data.launch_imbalance.max_iterations, 10u);
+  ASSERT_GE(plugin_data.launch_imbalance.idle_fraction(), 0.0);
+#if !defined(RAJA_ENABLE_OPENMP_IMBALANCE)
+  ASSERT_EQ(plugin_data.launch_imbalance.num_threads, 0);
+#endif
+
+  RAJA::forall<ExecPolicy>(
+    RAJA::RangeSegment(2,7),
+    PluginTestCallable{data}
+  );
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  5u);
+
+  plugin_test_resource->deallocate(data);
+}
+
 
 TYPED_TEST_SUITE_P(PluginForallTest);
 template <typename T>
@@ -234,10 +281,20 @@ TYPED_TEST_P(PluginForallTest, PluginForAllIcountIdxSet)
   PluginForAllIcountIdxSetTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginForallTest, PluginForAllNamed)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForAllNamedTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginForallTest,
                             PluginForall,
                             PluginForAllICount,
                             PluginForAllIdxSet,
-                            PluginForAllIcountIdxSet);
+                            PluginForAllIcountIdxSet,
+                            PluginForAllNamed);
 
 #endif  //__TEST_PLUGIN_FORALL_HPP__
@@ -59,6 +59,35 @@ void PluginKernelTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// test the context passed to plugins with a named kernel
+template <typename KernelPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginKernelNamedTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  const char* name = "PluginKernelNamed";
+
+  RAJA::kernel<KernelPolicy>(
+    RAJA::KernelName(name),
+    RAJA::make_tuple(RAJA::RangeSegment(0,10)),
+    PluginTestCallable{data}
+  );
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_STREQ(plugin_data.launch_kernel_name,  name);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  10u);
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::kernel);
+
+  plugin_test_resource->deallocate(data);
+}
+
 
 TYPED_TEST_SUITE_P(PluginKernelTest);
 template <typename T>
@@ -75,7 +104,17 @@ TYPED_TEST_P(PluginKernelTest, PluginKernel)
   PluginKernelTestImpl<KernelPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginKernelTest, PluginKernelNamed)
+{
+  using KernelPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginKernelNamedTestImpl<KernelPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginKernelTest,
-                            PluginKernel);
+                            PluginKernel,
+                            PluginKernelNamed);
 
 #endif  //__TEST_PLUGIN_KERNEL_HPP__
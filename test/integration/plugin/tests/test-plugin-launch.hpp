@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing basic integration tests for plugins with launch.
+///
+
+#ifndef __TEST_PLUGIN_LAUNCH_HPP__
+#define __TEST_PLUGIN_LAUNCH_HPP__
+
+#include "test-plugin.hpp"
+
+
+// test the context passed to plugins with named and unnamed launch
+template <typename WORKING_RES,
+          typename LAUNCH_POLICY,
+          typename TEAM_POLICY>
+void PluginLaunchNamedTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  constexpr int N = 10;
+  int* data = plugin_test_resource->allocate<int>(N);
+
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (plugin_test_resource->get_platform() == camp::resources::Platform::host) {
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  } else {
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  const char* name = "PluginLaunchNamed";
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(1),
+                     RAJA::KernelName(name)),
+    [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+      RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int i) {
+        data[i] = i;
+      });
+    });
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_STREQ(plugin_data.launch_kernel_name,  name);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  std::size_t(N));
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::launch);
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(2), RAJA::expt::Threads(1)),
+    [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext RAJA_UNUSED_ARG(ctx)) {
+    });
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  2u);
+
+  int check[N];
+  plugin_test_resource->memcpy(check, data, N*sizeof(int));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(check[i], i);
+  }
+
+  plugin_test_resource->deallocate(data);
+}
+
+
+TYPED_TEST_SUITE_P(PluginLaunchTest);
+template <typename T>
+class PluginLaunchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PluginLaunchTest, PluginLaunchNamed)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+
+  PluginLaunchNamedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY>( );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PluginLaunchTest,
+                            PluginLaunchNamed);
+
+#endif  //__TEST_PLUGIN_LAUNCH_HPP__
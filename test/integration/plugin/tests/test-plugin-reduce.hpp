@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing basic integration tests for plugins with reducers.
+///
+
+#ifndef __TEST_PLUGIN_REDUCE_HPP__
+#define __TEST_PLUGIN_REDUCE_HPP__
+
+#include "test-plugin.hpp"
+
+
+// test that reading the result of a reducer calls the plugins once per loop
+// that used it
+template <typename ExecPolicy,
+          typename ReducePolicy,
+          typename WORKING_RES>
+void PluginReduceTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  constexpr int N = 10;
+  RAJA::ReduceSum<ReducePolicy, int> sum(0);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+    sum += i;
+  });
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::forall);
+
+  ASSERT_EQ(sum.get(), N*(N-1)/2);
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::reduce);
+
+  // the result was already read, reading it again does not call the plugins
+  ASSERT_EQ(sum.get(), N*(N-1)/2);
+  ASSERT_EQ(static_cast<int>(sum), N*(N-1)/2);
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+
+  // using the reducer in another loop makes the next read call them again
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+    sum += i;
+  });
+
+  ASSERT_EQ(sum.get(), N*(N-1));
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     4);
+  ASSERT_EQ(plugin_data.launch_counter_post,    4);
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::reduce);
+}
+
+
+TYPED_TEST_SUITE_P(PluginReduceTest);
+template <typename T>
+class PluginReduceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PluginReduceTest, PluginReduceGet)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ReducePolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginReduceTestImpl<ExecPolicy, ReducePolicy, ResType>( );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PluginReduceTest,
+                            PluginReduceGet);
+
+#endif  //__TEST_PLUGIN_REDUCE_HPP__
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing basic integration tests for plugins with scan.
+///
+
+#ifndef __TEST_PLUGIN_SCAN_HPP__
+#define __TEST_PLUGIN_SCAN_HPP__
+
+#include "test-plugin.hpp"
+
+
+// test the context passed to plugins with inplace and out of place scans
+template <typename ExecPolicy,
+          typename WORKING_RES>
+void PluginScanTestImpl()
+{
+  WORKING_RES res = WORKING_RES::get_default();
+  SetupPluginVars spv(res);
+
+  constexpr int N = 10;
+  int* in  = plugin_test_resource->allocate<int>(N);
+  int* out = plugin_test_resource->allocate<int>(N);
+
+  int check[N];
+  for (int i = 0; i < N; ++i) {
+    check[i] = 1;
+  }
+  plugin_test_resource->memcpy(in, check, N*sizeof(int));
+
+  RAJA::inclusive_scan_inplace<ExecPolicy>(res, RAJA::make_span(in, N));
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  std::size_t(N));
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::scan);
+
+  RAJA::exclusive_scan<ExecPolicy>(res,
+                                   RAJA::make_span(in, N),
+                                   RAJA::make_span(out, N));
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  std::size_t(N));
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::scan);
+
+  // an empty scan has nothing to launch
+  RAJA::inclusive_scan_inplace<ExecPolicy>(res, RAJA::make_span(in, 0));
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+
+  plugin_test_resource->memcpy(check, out, N*sizeof(int));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(check[i], i*(i+1)/2);
+  }
+
+  plugin_test_resource->deallocate(out);
+  plugin_test_resource->deallocate(in);
+}
+
+
+TYPED_TEST_SUITE_P(PluginScanTest);
+template <typename T>
+class PluginScanTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PluginScanTest, PluginScan)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  PluginScanTestImpl<ExecPolicy, ResType>( );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PluginScanTest,
+                            PluginScan);
+
+#endif  //__TEST_PLUGIN_SCAN_HPP__
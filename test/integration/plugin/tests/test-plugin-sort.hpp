@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing basic integration tests for plugins with sort.
+///
+
+#ifndef __TEST_PLUGIN_SORT_HPP__
+#define __TEST_PLUGIN_SORT_HPP__
+
+#include "test-plugin.hpp"
+
+
+// test the context passed to plugins with sorts of keys and of pairs
+template <typename ExecPolicy,
+          typename WORKING_RES>
+void PluginSortTestImpl()
+{
+  WORKING_RES res = WORKING_RES::get_default();
+  SetupPluginVars spv(res);
+
+  constexpr int N = 10;
+  int* keys = plugin_test_resource->allocate<int>(N);
+  int* vals = plugin_test_resource->allocate<int>(N);
+
+  int check[N];
+  for (int i = 0; i < N; ++i) {
+    check[i] = N-1-i;
+  }
+  plugin_test_resource->memcpy(keys, check, N*sizeof(int));
+  plugin_test_resource->memcpy(vals, check, N*sizeof(int));
+
+  RAJA::sort<ExecPolicy>(res, RAJA::make_span(keys, N));
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  std::size_t(N));
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::sort);
+
+  RAJA::stable_sort_pairs<ExecPolicy>(res,
+                                      RAJA::make_span(vals, N),
+                                      RAJA::make_span(keys, N));
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  std::size_t(N));
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::sort);
+
+  // a single element is already sorted, there is nothing to launch
+  RAJA::sort<ExecPolicy>(res, RAJA::make_span(keys, 1));
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+
+  // the keys were sorted ascending, then reordered by sorting the values
+  plugin_test_resource->memcpy(check, keys, N*sizeof(int));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(check[i], N-1-i);
+  }
+
+  plugin_test_resource->deallocate(vals);
+  plugin_test_resource->deallocate(keys);
+}
+
+
+TYPED_TEST_SUITE_P(PluginSortTest);
+template <typename T>
+class PluginSortTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PluginSortTest, PluginSort)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  PluginSortTestImpl<ExecPolicy, ResType>( );
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PluginSortTest,
+                            PluginSort);
+
+#endif  //__TEST_PLUGIN_SORT_HPP__
@@ -157,6 +157,84 @@ void PluginWorkGroupTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// test the context passed to plugins with named and unnamed workgroup runs
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKINGRES,
+          RAJA::Platform PLATFORM>
+void PluginWorkGroupNamedTestImpl()
+{
+  using WorkPool_type = RAJA::WorkPool<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy>,
+                  IndexType,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  using WorkGroup_type = RAJA::WorkGroup<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy>,
+                  IndexType,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  SetupPluginVars spv(WORKINGRES{});
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  WorkPool_type pool(Allocator{});
+
+  for (int i = 0; i < 10; i++) {
+    pool.enqueue(RAJA::TypedRangeSegment<IndexType>{i,i+1},
+        PluginTestCallable{data});
+  }
+
+  WorkGroup_type group = pool.instantiate();
+
+  const char* name = "PluginWorkGroupNamed";
+
+  {
+    auto site = group.run(RAJA::KernelName(name));
+    RAJA_UNUSED_VAR(site);
+  }
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_STREQ(plugin_data.launch_kernel_name,  name);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  10u);
+  ASSERT_EQ(plugin_data.launch_pattern, RAJA::util::PluginPattern::workgroup);
+
+  {
+    auto site = group.run();
+    RAJA_UNUSED_VAR(site);
+  }
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_counter_post,    2);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     nullptr);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  10u);
+
+  {
+    CounterData loop_data[10];
+    plugin_test_resource->memcpy(&loop_data, data, 10*sizeof(CounterData));
+
+    for (int i = 0; i < 10; i++) {
+      ASSERT_EQ(loop_data[i].launch_platform_active, PLATFORM);
+      ASSERT_EQ(loop_data[i].launch_counter_pre,     2);
+      ASSERT_EQ(loop_data[i].launch_counter_post,    1);
+    }
+  }
+
+  plugin_test_resource->deallocate(data);
+}
+
 
 TYPED_TEST_SUITE_P(PluginWorkGroupTest);
 template <typename T>
@@ -177,7 +255,21 @@ TYPED_TEST_P(PluginWorkGroupTest, PluginWorkGroup)
   PluginWorkGroupTestImpl<ExecPolicy, OrderPolicy, StoragePolicy, IndexType, Allocator, WORKING_RESOURCE, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginWorkGroupTest, PluginWorkGroupNamed)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using StoragePolicy = typename camp::at<TypeParam, camp::num<2>>::type;
+  using IndexType = typename camp::at<TypeParam, camp::num<3>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<4>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<5>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<6>>::type;
+
+  PluginWorkGroupNamedTestImpl<ExecPolicy, OrderPolicy, StoragePolicy, IndexType, Allocator, WORKING_RESOURCE, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginWorkGroupTest,
-                            PluginWorkGroup);
+                            PluginWorkGroup,
+                            PluginWorkGroupNamed);
 
 #endif  //__TEST_PLUGIN_WORKGROUP_HPP__
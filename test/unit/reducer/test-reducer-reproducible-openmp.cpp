@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for results of reproducible reducers that
+/// do not depend on the number of OpenMP threads.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstring>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+struct ReproducibleResult
+{
+  double sum;
+  int minloc;
+  int maxloc;
+};
+
+static ReproducibleResult reduce_with_threads(std::vector<double> const& a,
+                                              int num_threads)
+{
+  const int saved_threads = omp_get_max_threads();
+  omp_set_num_threads(num_threads);
+
+  const double* data = a.data();
+  RAJA::ReduceSum<RAJA::omp_reduce_reproducible, double> sum(0.0);
+  RAJA::ReduceMinLoc<RAJA::omp_reduce_reproducible, double, int> minloc(1.0e300, -1);
+  RAJA::ReduceMaxLoc<RAJA::omp_reduce_reproducible, double, int> maxloc(-1.0e300, -1);
+
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<1>>(
+      RAJA::TypedRangeSegment<int>(0, static_cast<int>(a.size())),
+      [=](int i) {
+        sum += data[i];
+        minloc.minloc(data[i], i);
+        maxloc.maxloc(data[i], i);
+      });
+
+  omp_set_num_threads(saved_threads);
+
+  return ReproducibleResult{sum.get(), minloc.getLoc(), maxloc.getLoc()};
+}
+
+TEST(ReducerReproducibleUnitTest, OpenMPThreadCountIndependent)
+{
+  // values of very different magnitude make the rounded sum depend on the
+  // order of additions, and each extreme value occurs many times
+  std::vector<double> a(10007);
+  for (size_t i = 0; i < a.size(); ++i) {
+    switch (i % 7) {
+      case 0: a[i] = 1.0e16; break;
+      case 1: a[i] = -1.0e16; break;
+      case 2: a[i] = 0.1 * static_cast<double>(i % 13); break;
+      case 3: a[i] = -3.0; break;
+      case 4: a[i] = 7.0; break;
+      default: a[i] = 1.0 / static_cast<double>(i + 1); break;
+    }
+  }
+
+  const ReproducibleResult ref = reduce_with_threads(a, 1);
+  ASSERT_EQ(ref.minloc, 1);
+  ASSERT_EQ(ref.maxloc, 0);
+
+  for (int num_threads : {2, 3, 4, 7, 16}) {
+    const ReproducibleResult res = reduce_with_threads(a, num_threads);
+    ASSERT_EQ(std::memcmp(&res.sum, &ref.sum, sizeof(double)), 0)
+        << num_threads << " threads";
+    ASSERT_EQ(res.minloc, ref.minloc) << num_threads << " threads";
+    ASSERT_EQ(res.maxloc, ref.maxloc) << num_threads << " threads";
+  }
+}
+
+#endif
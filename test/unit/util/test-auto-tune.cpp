@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the tuning database and the
+/// auto_tune_exec policy
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/policy/AutoTunePolicy.hpp"
+#include "RAJA/util/TuningDatabase.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+TEST(TuningDatabaseUnitTest, SaveAndLoad)
+{
+  const std::string path = "test-auto-tune-database.txt";
+
+  RAJA::util::TuningDatabase database;
+  database.set("kernel\t1", "policy a");
+  database.set("kernel\t2", "policy\tb");
+  EXPECT_EQ(database.size(), 2u);
+  ASSERT_TRUE(database.save(path));
+
+  RAJA::util::TuningDatabase loaded;
+  ASSERT_TRUE(loaded.load(path));
+  EXPECT_EQ(loaded.size(), 2u);
+
+  // tabs in values are replaced, keys are matched as given
+  std::string value;
+  ASSERT_TRUE(loaded.get("kernel\t1", value));
+  EXPECT_EQ(value, "policy a");
+  ASSERT_TRUE(loaded.get("kernel\t2", value));
+  EXPECT_EQ(value, "policy b");
+  EXPECT_FALSE(loaded.get("kernel\t3", value));
+
+  std::remove(path.c_str());
+}
+
+TEST(AutoTunerUnitTest, LocksInFastestCandidate)
+{
+  using RAJA::policy::autotune::detail::AutoTuner;
+
+  const char* const candidates[] = {"slow", "fast", "medium"};
+  const double seconds[] = {3.0, 1.0, 2.0};
+
+  AutoTuner tuner;
+  const int launches = 3 * tuner.trials();
+  for (int l = 0; l < launches; ++l) {
+    const AutoTuner::Choice choice =
+        tuner.choose("AutoTunerUnitTest", 1000, candidates, 3);
+    ASSERT_TRUE(choice.timed);
+    EXPECT_EQ(choice.candidate, l % 3);
+    tuner.record(choice, seconds[choice.candidate], candidates);
+  }
+
+  const AutoTuner::Choice choice =
+      tuner.choose("AutoTunerUnitTest", 1000, candidates, 3);
+  EXPECT_FALSE(choice.timed);
+  EXPECT_EQ(choice.candidate, 1);
+
+  // other sizes are tuned separately
+  EXPECT_TRUE(tuner.choose("AutoTunerUnitTest", 10, candidates, 3).timed);
+
+  // the decision is in the database, a new tuner starts from it
+  std::string stored;
+  ASSERT_TRUE(RAJA::util::tuning_database().get(
+      AutoTuner::database_key("AutoTunerUnitTest",
+                              AutoTuner::size_bucket(1000),
+                              candidates,
+                              3),
+      stored));
+  EXPECT_EQ(stored, "fast");
+
+  AutoTuner reloaded;
+  const AutoTuner::Choice reloaded_choice =
+      reloaded.choose("AutoTunerUnitTest", 1000, candidates, 3);
+  EXPECT_FALSE(reloaded_choice.timed);
+  EXPECT_EQ(reloaded_choice.candidate, 1);
+
+  // a changed candidate list is tuned again, even with the same length
+  const char* const changed[] = {"slow", "fast", "other"};
+  EXPECT_TRUE(reloaded.choose("AutoTunerUnitTest", 1000, changed, 3).timed);
+}
+
+TEST(AutoTunerUnitTest, SizeBuckets)
+{
+  using RAJA::policy::autotune::detail::AutoTuner;
+
+  EXPECT_EQ(AutoTuner::size_bucket(0), 0);
+  EXPECT_EQ(AutoTuner::size_bucket(1), 0);
+  EXPECT_EQ(AutoTuner::size_bucket(2), 1);
+  EXPECT_EQ(AutoTuner::size_bucket(1023), 9);
+  EXPECT_EQ(AutoTuner::size_bucket(1024), 10);
+}
+
+TEST(AutoTuneForallUnitTest, NamedAndUnnamedKernels)
+{
+  using policy = RAJA::auto_tune_exec<RAJA::seq_exec, RAJA::loop_exec>;
+
+  constexpr int N = 100;
+  std::vector<int> a(N, 0);
+  int* pa = a.data();
+
+  // enough launches to time both candidates, whatever RAJA_AUTOTUNE_TRIALS is
+  const int launches =
+      2 * RAJA::policy::autotune::detail::auto_tuner().trials() + 1;
+  for (int l = 0; l < launches; ++l) {
+    RAJA::forall<policy>(RAJA::KernelName("AutoTuneForallUnitTest"),
+                         RAJA::TypedRangeSegment<int>(0, N),
+                         [=](int i) { pa[i] += 1; });
+  }
+  RAJA::forall<policy>(RAJA::TypedRangeSegment<int>(0, N),
+                       [=](int i) { pa[i] += 1; });
+
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(a[i], launches + 1);
+  }
+
+  // both candidates were timed often enough, so a choice was made
+  const char* const candidates[] = {RAJA::util::type_name<RAJA::seq_exec>(),
+                                    RAJA::util::type_name<RAJA::loop_exec>()};
+  std::string stored;
+  ASSERT_TRUE(RAJA::util::tuning_database().get(
+      RAJA::policy::autotune::detail::AutoTuner::database_key(
+          "AutoTuneForallUnitTest",
+          RAJA::policy::autotune::detail::AutoTuner::size_bucket(N),
+          candidates,
+          2),
+      stored));
+  EXPECT_TRUE(stored == RAJA::util::type_name<RAJA::seq_exec>() ||
+              stored == RAJA::util::type_name<RAJA::loop_exec>());
+}
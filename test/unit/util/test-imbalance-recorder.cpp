@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the load imbalance measurement
+/// reported to plugins
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/ImbalanceRecorder.hpp"
+
+namespace {
+
+using clock = RAJA::util::detail::ImbalanceRecorder::clock;
+
+clock::time_point at(double seconds)
+{
+  return clock::time_point(std::chrono::duration_cast<clock::duration>(
+      std::chrono::duration<double>(seconds)));
+}
+
+}  // namespace
+
+TEST(ImbalanceRecorderUnitTest, NothingRecorded)
+{
+  RAJA::util::detail::ImbalanceRecorder recorder;
+  recorder.reserve(4);
+
+  const RAJA::util::LoadImbalance imbalance = recorder.result();
+  EXPECT_EQ(imbalance.num_threads, 0);
+  EXPECT_EQ(imbalance.num_spans, 0u);
+  EXPECT_EQ(imbalance.max_over_mean(), 1.0);
+  EXPECT_EQ(imbalance.idle_fraction(), 0.0);
+}
+
+TEST(ImbalanceRecorderUnitTest, SumsRegionsPerThread)
+{
+  RAJA::util::detail::ImbalanceRecorder recorder;
+
+  // two regions, thread 2 only takes part in the second one
+  recorder.reserve(2);
+  recorder.add(0, at(0.0), at(1.0), 10);
+  recorder.add(1, at(0.0), at(3.0), 30);
+  recorder.reserve(3);
+  recorder.add(0, at(3.0), at(4.0), 10);
+  recorder.add(1, at(3.0), at(4.0), 10);
+  recorder.add(2, at(3.0), at(5.0), 20);
+
+  // out of range threads are ignored
+  recorder.add(3, at(0.0), at(100.0), 1000);
+  recorder.add(-1, at(0.0), at(100.0), 1000);
+
+  const RAJA::util::LoadImbalance imbalance = recorder.result();
+  EXPECT_EQ(imbalance.num_threads, 3);
+  EXPECT_DOUBLE_EQ(imbalance.min_seconds, 2.0);
+  EXPECT_DOUBLE_EQ(imbalance.max_seconds, 4.0);
+  EXPECT_DOUBLE_EQ(imbalance.mean_seconds, 8.0 / 3.0);
+  EXPECT_EQ(imbalance.min_iterations, 20u);
+  EXPECT_EQ(imbalance.max_iterations, 40u);
+  EXPECT_DOUBLE_EQ(imbalance.max_over_mean(), 1.5);
+  EXPECT_DOUBLE_EQ(imbalance.idle_fraction(), 1.0 / 3.0);
+
+  // one span per thread and region, grouped by thread
+  ASSERT_EQ(imbalance.num_spans, 5u);
+  const int threads[] = {0, 0, 1, 1, 2};
+  const std::size_t iterations[] = {10, 10, 30, 10, 20};
+  for (std::size_t i = 0; i < imbalance.num_spans; ++i) {
+    EXPECT_EQ(imbalance.spans[i].thread, threads[i]);
+    EXPECT_EQ(imbalance.spans[i].iterations, iterations[i]);
+  }
+  EXPECT_EQ(imbalance.spans[4].start, at(3.0));
+  EXPECT_EQ(imbalance.spans[4].stop, at(5.0));
+}
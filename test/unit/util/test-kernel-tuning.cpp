@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the tile size and launch thread
+/// tuning tables
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/KernelTuning.hpp"
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(KernelTuningUnitTest, Key)
+{
+  EXPECT_EQ(RAJA::util::tuning_key("tile", "transpose", {100, 200}, 8),
+            "tile\ttranspose\t100 200\t8");
+  EXPECT_EQ(RAJA::util::tuning_key("launch", "k", {4}),
+            "launch\tk\t4\t" +
+                std::to_string(RAJA::util::tuning_thread_count()));
+}
+
+TEST(KernelTuningUnitTest, TileSizes)
+{
+  auto sizes =
+      RAJA::util::tuned_tile_sizes("tuning-test-tile", {64, 32}, {16, 8});
+  EXPECT_EQ(sizes[0], 16);
+  EXPECT_EQ(sizes[1], 8);
+
+  const std::string key =
+      RAJA::util::tuning_key("tile", "tuning-test-tile", {64, 32});
+  RAJA::util::set_tuned_values(key, {32, 4});
+  sizes = RAJA::util::tuned_tile_sizes("tuning-test-tile", {64, 32}, {16, 8});
+  EXPECT_EQ(sizes[0], 32);
+  EXPECT_EQ(sizes[1], 4);
+
+  // other dimensions are tuned separately
+  sizes = RAJA::util::tuned_tile_sizes("tuning-test-tile", {64, 64}, {16, 8});
+  EXPECT_EQ(sizes[0], 16);
+
+  // entries with the wrong number of sizes, or invalid ones, are ignored
+  RAJA::util::tuning_database().set(key, "32");
+  EXPECT_EQ(RAJA::util::tuned_tile_sizes(
+                "tuning-test-tile", {64, 32}, {16, 8})[0],
+            16);
+  RAJA::util::tuning_database().set(key, "32 0");
+  EXPECT_EQ(RAJA::util::tuned_tile_sizes(
+                "tuning-test-tile", {64, 32}, {16, 8})[0],
+            16);
+  RAJA::util::tuning_database().set(key, "32 x");
+  EXPECT_EQ(RAJA::util::tuned_tile_sizes(
+                "tuning-test-tile", {64, 32}, {16, 8})[0],
+            16);
+}
+
+TEST(KernelTuningUnitTest, SearchTileSizes)
+{
+  std::vector<std::array<RAJA::Index_type, 2>> candidates{
+      {{8, 8}}, {{16, 4}}, {{32, 2}}};
+
+  int runs = 0;
+  auto best = RAJA::util::tune_tile_sizes(
+      "tuning-test-search", {128, 128}, candidates,
+      [&](const std::array<RAJA::Index_type, 2>& tile) {
+        ++runs;
+        // the middle candidate is fastest
+        const int ms = tile[0] == 16 ? 1 : 20;
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+      },
+      2);
+
+  EXPECT_EQ(runs, 6);
+  EXPECT_EQ(best[0], 16);
+  EXPECT_EQ(best[1], 4);
+
+  auto sizes = RAJA::util::tuned_tile_sizes(
+      "tuning-test-search", {128, 128}, {1, 1});
+  EXPECT_EQ(sizes[0], 16);
+  EXPECT_EQ(sizes[1], 4);
+}
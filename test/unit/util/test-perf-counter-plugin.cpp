@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the PerfCounterPlugin class
+///
+/// Hardware counters are often not available on test machines, the tests
+/// check the plugin works either way.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/PerfCounterPlugin.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(PerfCounterPluginUnitTest, LaunchesWithOrWithoutCounters)
+{
+  RAJA::util::PerfCounterPlugin perf;
+
+  RAJA::util::PluginContext context{RAJA::Platform::host,
+                                    RAJA::util::PluginPattern::forall,
+                                    "test_policy",
+                                    RAJA::util::KernelName("stream"),
+                                    1000};
+
+  std::vector<double> a(1000, 1.0);
+  for (int r = 0; r < 3; ++r) {
+    perf.preLaunch(context);
+    for (double& val : a) {
+      val = val * 2.0 + 1.0;
+    }
+    perf.postLaunch(context);
+  }
+
+  std::stringstream csv;
+  perf.write_report(csv);
+
+  std::string line;
+  std::getline(csv, line);
+  EXPECT_EQ(line.find("pattern,kernel,policy,launches,seconds,instructions"),
+            0u);
+  EXPECT_EQ(line.substr(line.rfind(',') + 1), "scaled");
+
+  if (perf.available()) {
+    ASSERT_TRUE(static_cast<bool>(std::getline(csv, line)));
+    EXPECT_EQ(line.find("forall,\"stream\",\"test_policy\",3,"), 0u);
+  } else {
+    EXPECT_FALSE(static_cast<bool>(std::getline(csv, line)));
+  }
+
+  perf.finalize();
+}
+
+#if defined(__linux__)
+TEST(PerfCounterPluginUnitTest, FlopsNeedTheEventToOpen)
+{
+  RAJA::util::PerfCounterPlugin perf;
+  EXPECT_FALSE(perf.counts_flops());
+
+  // not an event of any cpu, the flops column must stay empty
+  setenv("RAJA_PERF_COUNTERS_FLOP_EVENT", "0xffffffffffffffff", 1);
+  perf.init(RAJA::util::make_options(""));
+  unsetenv("RAJA_PERF_COUNTERS_FLOP_EVENT");
+
+  if (!perf.available()) {
+    EXPECT_FALSE(perf.counts_flops());
+  }
+
+  perf.init(RAJA::util::make_options(""));
+  EXPECT_FALSE(perf.counts_flops());
+}
+#endif
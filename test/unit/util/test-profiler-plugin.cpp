@@ -0,0 +1,249 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the ProfilerPlugin class
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/ProfilerPlugin.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static RAJA::util::PluginContext make_test_context(const char* name,
+                                                   std::size_t num_iterations)
+{
+  return RAJA::util::PluginContext{RAJA::Platform::host,
+                                   RAJA::util::PluginPattern::forall,
+                                   "test_policy<a, b>",
+                                   RAJA::util::KernelName(name),
+                                   num_iterations};
+}
+
+// finalize the profiler into a file owned by the test and return the report
+static std::string finalize_to_file(RAJA::util::ProfilerPlugin& profiler,
+                                    const std::string& path,
+                                    bool json)
+{
+  profiler.set_output(path, json);
+  profiler.finalize();
+
+  std::stringstream report;
+  {
+    std::ifstream in(path);
+    report << in.rdbuf();
+  }
+  std::remove(path.c_str());
+  return report.str();
+}
+
+TEST(ProfilerPluginUnitTest, CountsLaunchesPerKernel)
+{
+  RAJA::util::ProfilerPlugin profiler;
+  ASSERT_EQ(profiler.sample_rate(), 1u);
+
+  auto daxpy = make_test_context("daxpy", 100);
+  auto dot = make_test_context("dot", 10);
+
+  for (int i = 0; i < 5; ++i) {
+    profiler.preLaunch(daxpy);
+    profiler.postLaunch(daxpy);
+  }
+  profiler.preLaunch(dot);
+  profiler.postLaunch(dot);
+
+  std::stringstream csv;
+  profiler.write_report(csv, false);
+
+  std::string header;
+  std::getline(csv, header);
+  EXPECT_EQ(header.find("pattern,kernel,policy,file,line,calls,samples"), 0u);
+
+  std::string line;
+  std::getline(csv, line);
+  EXPECT_EQ(line.find("forall,\"daxpy\",\"test_policy<a, b>\""), 0u);
+  EXPECT_NE(line.find(",5,5,"), std::string::npos);
+
+  std::getline(csv, line);
+  EXPECT_EQ(line.find("forall,\"dot\""), 0u);
+  EXPECT_NE(line.find(",1,1,"), std::string::npos);
+
+  const std::string report = finalize_to_file(
+      profiler, "test-profiler-plugin-counts.csv", false);
+  EXPECT_EQ(report.find("pattern,kernel,policy,file,line,calls,samples"), 0u);
+  EXPECT_NE(report.find("forall,\"daxpy\""), std::string::npos);
+  EXPECT_NE(report.find("forall,\"dot\""), std::string::npos);
+
+  std::stringstream empty;
+  profiler.write_report(empty, false);
+  std::getline(empty, header);
+  EXPECT_FALSE(std::getline(empty, line));
+}
+
+TEST(ProfilerPluginUnitTest, SamplesEachKernelSeparately)
+{
+  RAJA::util::ProfilerPlugin profiler;
+  profiler.set_sample_rate(2);
+  ASSERT_EQ(profiler.sample_rate(), 2u);
+
+  auto even = make_test_context("even", 1);
+  auto odd = make_test_context("odd", 1);
+
+  // interleaved launches alias with a launch counter shared by all kernels
+  for (int i = 0; i < 7; ++i) {
+    profiler.preLaunch(even);
+    profiler.postLaunch(even);
+    profiler.preLaunch(odd);
+    profiler.postLaunch(odd);
+  }
+
+  std::stringstream csv;
+  profiler.write_report(csv, false);
+
+  std::string line;
+  std::getline(csv, line);
+
+  std::getline(csv, line);
+  EXPECT_EQ(line.find("forall,\"even\""), 0u);
+  EXPECT_NE(line.find(",7,4,"), std::string::npos);
+
+  std::getline(csv, line);
+  EXPECT_EQ(line.find("forall,\"odd\""), 0u);
+  EXPECT_NE(line.find(",7,4,"), std::string::npos);
+
+  const std::string report = finalize_to_file(
+      profiler, "test-profiler-plugin-samples.csv", false);
+  EXPECT_NE(report.find("forall,\"even\""), std::string::npos);
+  EXPECT_NE(report.find("forall,\"odd\""), std::string::npos);
+}
+
+TEST(ProfilerPluginUnitTest, NestedLaunches)
+{
+  RAJA::util::ProfilerPlugin profiler;
+
+  auto outer = make_test_context("outer", 1);
+  auto inner = make_test_context("inner", 1);
+
+  profiler.preLaunch(outer);
+  profiler.preLaunch(inner);
+  profiler.postLaunch(inner);
+  profiler.postLaunch(outer);
+
+  std::stringstream json;
+  profiler.write_report(json, true);
+  const std::string report = json.str();
+
+  EXPECT_EQ(report.find("{\"sample_rate\": 1"), 0u);
+  EXPECT_NE(report.find("\"kernel\": \"outer\""), std::string::npos);
+  EXPECT_NE(report.find("\"kernel\": \"inner\""), std::string::npos);
+
+  EXPECT_EQ(finalize_to_file(profiler, "test-profiler-plugin-nested.json", true),
+            report);
+}
+
+TEST(ProfilerPluginUnitTest, Roofline)
+{
+  RAJA::util::ProfilerPlugin profiler;
+  profiler.set_peak(100.0, 50.0);
+
+  auto triad = RAJA::util::PluginContext{
+      RAJA::Platform::host,
+      RAJA::util::PluginPattern::forall,
+      "test_policy<a, b>",
+      RAJA::util::KernelName("triad").with_work(24, 2),
+      1000000};
+  EXPECT_EQ(triad.work.bytes_per_iteration, 24.0);
+  EXPECT_EQ(triad.work.flops_per_iteration, 2.0);
+
+  profiler.preLaunch(triad);
+  profiler.postLaunch(triad);
+
+  std::stringstream json;
+  profiler.write_report(json, true);
+  const std::string report = json.str();
+  EXPECT_NE(report.find("\"peak_gb_per_s\": 100"), std::string::npos);
+  EXPECT_NE(report.find("\"bytes_per_it\": 24"), std::string::npos);
+  EXPECT_NE(report.find("\"flops_per_it\": 2"), std::string::npos);
+
+  // intensity 1/12 flop per byte puts the bound at 100/12 GFLOP/s
+  RAJA::util::ProfilerPlugin::KernelStats stats;
+  stats.work = triad.work;
+  stats.total_iterations = 1.0e9;
+  stats.total_seconds = 0.48;
+  EXPECT_DOUBLE_EQ(stats.gb_per_s(), 50.0);
+  EXPECT_NEAR(profiler.roofline_fraction(stats), 0.5, 1e-12);
+
+  // without a bandwidth roof the compute roof is used
+  profiler.set_peak(0.0, 50.0);
+  EXPECT_NEAR(profiler.roofline_fraction(stats), stats.gflop_per_s() / 50.0,
+              1e-12);
+
+  // kernels without flops are compared with the bandwidth roof
+  profiler.set_peak(100.0, 0.0);
+  stats.work.flops_per_iteration = 0.0;
+  EXPECT_NEAR(profiler.roofline_fraction(stats), 0.5, 1e-12);
+
+  // kernels without an estimate have no bound
+  stats.work = RAJA::util::WorkEstimate{};
+  EXPECT_EQ(profiler.roofline_fraction(stats), 0.0);
+
+  // the bandwidth was set, finalize does not measure it
+  const std::string final_report = finalize_to_file(
+      profiler, "test-profiler-plugin-roofline.json", true);
+  EXPECT_NE(final_report.find("\"kernel\": \"triad\""), std::string::npos);
+  EXPECT_NE(final_report.find("\"peak_gb_per_s\": 100"), std::string::npos);
+}
+
+TEST(ProfilerPluginUnitTest, ProbeOnlyOnExplicitFinalize)
+{
+  auto triad = RAJA::util::PluginContext{
+      RAJA::Platform::host,
+      RAJA::util::PluginPattern::forall,
+      "test_policy<a, b>",
+      RAJA::util::KernelName("triad").with_work(24, 2),
+      1000};
+
+  // the report written on destruction leaves the peak unknown
+  const std::string path = "test-profiler-plugin-destroyed.json";
+  {
+    RAJA::util::ProfilerPlugin profiler;
+    profiler.set_peak(0.0, 0.0);
+    profiler.set_output(path, true);
+    profiler.preLaunch(triad);
+    profiler.postLaunch(triad);
+  }
+  std::stringstream destroyed;
+  {
+    std::ifstream in(path);
+    destroyed << in.rdbuf();
+  }
+  std::remove(path.c_str());
+  EXPECT_NE(destroyed.str().find("\"peak_gb_per_s\": 0,"), std::string::npos);
+
+  // an explicit finalize measures it with the configured probe size
+  RAJA::util::ProfilerPlugin profiler;
+  profiler.set_peak(0.0, 0.0);
+  profiler.set_probe_size(1 << 16);
+  EXPECT_EQ(profiler.probe_size(), std::size_t(1 << 16));
+  profiler.set_probe_size(0);
+  EXPECT_EQ(profiler.probe_size(), std::size_t(1 << 16));
+
+  profiler.preLaunch(triad);
+  profiler.postLaunch(triad);
+  finalize_to_file(profiler, "test-profiler-plugin-finalized.json", true);
+  EXPECT_GT(profiler.peak_gb_per_s(), 0.0);
+}
+
+TEST(ProfilerPluginUnitTest, BandwidthProbe)
+{
+  EXPECT_GT(RAJA::util::stream_triad_bandwidth(1 << 16, 2), 0.0);
+  EXPECT_EQ(RAJA::util::stream_triad_bandwidth(0), 0.0);
+}
@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the TracePlugin class
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::size_t count(const std::string& str, const std::string& sub)
+{
+  std::size_t n = 0;
+  for (std::size_t pos = str.find(sub); pos != std::string::npos;
+       pos = str.find(sub, pos + sub.size())) {
+    ++n;
+  }
+  return n;
+}
+
+}  // namespace
+
+TEST(TracePluginUnitTest, NestedLaunchesOnTwoThreads)
+{
+  RAJA::util::TracePlugin trace;
+
+  RAJA::util::PluginContext outer{RAJA::Platform::host,
+                                  RAJA::util::PluginPattern::launch,
+                                  "outer_policy",
+                                  RAJA::util::KernelName("outer"),
+                                  4};
+  RAJA::util::PluginContext inner{RAJA::Platform::host,
+                                  RAJA::util::PluginPattern::forall,
+                                  "inner_policy",
+                                  RAJA::util::KernelName("inner"),
+                                  100};
+
+  auto work = [&]() {
+    trace.preLaunch(outer);
+    trace.preLaunch(inner);
+    trace.postLaunch(inner);
+    trace.postLaunch(outer);
+  };
+  work();
+  std::thread other(work);
+  other.join();
+
+  std::stringstream json;
+  trace.write_trace(json);
+  const std::string str = json.str();
+
+  EXPECT_EQ(str.find("{\"displayTimeUnit\": \"ns\", \"traceEvents\": ["), 0u);
+  EXPECT_EQ(count(str, "\"ph\": \"M\""), 2u);
+  EXPECT_EQ(count(str, "\"ph\": \"X\""), 4u);
+  EXPECT_EQ(count(str, "\"name\": \"outer\", \"cat\": \"launch\""), 2u);
+  EXPECT_EQ(count(str, "\"name\": \"inner\", \"cat\": \"forall\""), 2u);
+  EXPECT_EQ(count(str, "\"tid\": 0,"), 3u);
+  EXPECT_EQ(count(str, "\"tid\": 1,"), 3u);
+  EXPECT_NE(str.find("\"policy\": \"inner_policy\", \"iterations\": 100"),
+            std::string::npos);
+
+  // writing clears the buffers
+  std::stringstream empty;
+  trace.write_trace(empty);
+  EXPECT_EQ(count(empty.str(), "\"ph\": \"X\""), 0u);
+}
+
+TEST(TracePluginUnitTest, RingBufferKeepsNewestEvents)
+{
+  RAJA::util::TracePlugin::RingBuffer buffer(4, 0, -1);
+  EXPECT_TRUE(buffer.empty());
+
+  RAJA::util::TracePlugin::Event event{};
+  for (int i = 0; i < 6; ++i) {
+    event.num_iterations = i;
+    buffer.push(event);
+  }
+  EXPECT_EQ(buffer.dropped(), 2u);
+
+  std::size_t expected = 2;
+  buffer.for_each([&](const RAJA::util::TracePlugin::Event& e) {
+    EXPECT_EQ(e.num_iterations, expected);
+    ++expected;
+  });
+  EXPECT_EQ(expected, 6u);
+
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(TracePluginUnitTest, RingBufferAllocatesAsItFills)
+{
+  using RingBuffer = RAJA::util::TracePlugin::RingBuffer;
+  const std::size_t capacity = 2 * RingBuffer::chunk_size + 100;
+  RingBuffer buffer(capacity, 0, -1);
+  EXPECT_EQ(buffer.allocated(), 0u);
+
+  RAJA::util::TracePlugin::Event event{};
+  buffer.push(event);
+  EXPECT_EQ(buffer.allocated(), std::size_t(RingBuffer::chunk_size));
+
+  for (std::size_t i = 1; i < capacity + 10; ++i) {
+    event.num_iterations = i;
+    buffer.push(event);
+  }
+  EXPECT_EQ(buffer.allocated(), capacity);
+  EXPECT_EQ(buffer.dropped(), 10u);
+
+  std::size_t expected = 10;
+  buffer.for_each([&](const RAJA::util::TracePlugin::Event& e) {
+    EXPECT_EQ(e.num_iterations, expected);
+    ++expected;
+  });
+  EXPECT_EQ(expected, capacity + 10);
+}
+
+TEST(TracePluginUnitTest, OpenMPThreadSharesOnOwnTracks)
+{
+  RAJA::util::TracePlugin trace;
+
+  RAJA::util::PluginContext loop{RAJA::Platform::host,
+                                 RAJA::util::PluginPattern::forall,
+                                 "omp_policy",
+                                 RAJA::util::KernelName("loop"),
+                                 30};
+
+  // shares as measured with RAJA_ENABLE_OPENMP_IMBALANCE
+  const auto now = std::chrono::steady_clock::now();
+  const RAJA::util::ThreadSpan spans[] = {{0, now, now, 10},
+                                          {0, now, now, 5},
+                                          {1, now, now, 15}};
+  trace.preLaunch(loop);
+  loop.imbalance.num_threads = 2;
+  loop.imbalance.spans = spans;
+  loop.imbalance.num_spans = 3;
+  trace.postLaunch(loop);
+
+  std::stringstream json;
+  trace.write_trace(json);
+  const std::string str = json.str();
+
+  EXPECT_EQ(count(str, "\"ph\": \"M\""), 3u);
+  EXPECT_EQ(count(str, "\"ph\": \"X\""), 4u);
+  EXPECT_EQ(count(str, "\"name\": \"loop\", \"cat\": \"forall\""), 4u);
+  EXPECT_NE(str.find("\"thread 0 / OpenMP thread 1\""), std::string::npos);
+  EXPECT_EQ(count(str, "\"tid\": 0,"), 2u);
+  EXPECT_EQ(count(str, "\"tid\": 10000,"), 3u);
+  EXPECT_EQ(count(str, "\"tid\": 10001,"), 2u);
+  EXPECT_NE(str.find("\"iterations\": 15"), std::string::npos);
+}
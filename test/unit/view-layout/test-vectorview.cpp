@@ -0,0 +1,198 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+
+using VectorViewRegisterTypes =
+    ::testing::Types<RAJA::SimdRegister<double, RAJA::simd_scalar_arch>,
+                     RAJA::SimdRegister<double, RAJA::simd_avx2_arch>,
+                     RAJA::SimdRegister<double, RAJA::simd_avx512_arch>,
+                     RAJA::SimdRegister<double, RAJA::simd_neon_arch>,
+                     RAJA::simd_register<double>>;
+
+template<typename T>
+class VectorViewUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(VectorViewUnitTest, VectorViewRegisterTypes);
+
+TYPED_TEST(VectorViewUnitTest, RegisterMaskedLoadStore)
+{
+  using register_t = TypeParam;
+  constexpr camp::idx_t lanes = register_t::num_lanes;
+
+  std::vector<double> a(4 * lanes), b(4 * lanes);
+  for (camp::idx_t i = 0; i < 4 * lanes; ++i) {
+    a[i] = i + 1;
+  }
+
+  for (camp::idx_t n = 0; n <= lanes; ++n) {
+    register_t x;
+    x.load_n(a.data(), n);
+    for (camp::idx_t l = 0; l < lanes; ++l) {
+      ASSERT_EQ(x.get(l), l < n ? a[l] : 0.0);
+    }
+    ASSERT_EQ(x.sum(), n * (n + 1) / 2.0);
+
+    std::fill(b.begin(), b.end(), -1.0);
+    (x * 2.0 + 1.0).store_n(b.data(), n);
+    for (camp::idx_t l = 0; l <= lanes; ++l) {
+      ASSERT_EQ(b[l], l < n ? 2.0 * a[l] + 1.0 : -1.0);
+    }
+
+    register_t s;
+    s.load_strided(a.data(), 3, n);
+    std::fill(b.begin(), b.end(), -1.0);
+    s.store_strided(b.data(), 2, n);
+    for (camp::idx_t l = 0; l < 2 * lanes; ++l) {
+      ASSERT_EQ(b[l], (l % 2 == 0 && l / 2 < n) ? a[3 * (l / 2)] : -1.0);
+    }
+  }
+}
+
+TYPED_TEST(VectorViewUnitTest, ForallStrideOne)
+{
+  using register_t = TypeParam;
+  using layout = RAJA::Layout<2>;
+
+  constexpr camp::idx_t N_r = 3;
+  constexpr camp::idx_t N_c = 4 * register_t::num_lanes + 3;
+
+  std::vector<double> a(N_r * N_c), b(N_r * N_c, 0.0);
+  for (camp::idx_t i = 0; i < N_r * N_c; ++i) {
+    a[i] = i;
+  }
+
+  RAJA::View<double, layout> A(a.data(), N_r, N_c);
+  RAJA::View<double, layout> B(b.data(), N_r, N_c);
+
+  for (camp::idx_t r = 0; r < N_r; ++r) {
+    RAJA::forall<RAJA::simd_vector_exec<register_t>>(
+        RAJA::TypedRangeSegment<camp::idx_t>(0, N_c - 1), [=](auto c) {
+          B(r, c) = A(r, c) * 2.0 + 1.0;
+        });
+  }
+
+  for (camp::idx_t r = 0; r < N_r; ++r) {
+    for (camp::idx_t c = 0; c < N_c; ++c) {
+      ASSERT_EQ(B(r, c), c < N_c - 1 ? 2.0 * A(r, c) + 1.0 : 0.0);
+    }
+  }
+}
+
+TYPED_TEST(VectorViewUnitTest, ForallStrided)
+{
+  using register_t = TypeParam;
+  using layout = RAJA::Layout<2>;
+
+  constexpr camp::idx_t N_r = 2 * register_t::num_lanes + 1;
+  constexpr camp::idx_t N_c = 5;
+
+  std::vector<double> a(N_r * N_c), at(N_r * N_c, 0.0);
+  for (camp::idx_t i = 0; i < N_r * N_c; ++i) {
+    a[i] = i;
+  }
+
+  RAJA::View<double, layout> A(a.data(), N_r, N_c);
+  RAJA::View<double, layout> At(at.data(), N_c, N_r);
+
+  // vectorized over the rows of A, which are not stride-one
+  for (camp::idx_t c = 0; c < N_c; ++c) {
+    RAJA::forall<RAJA::simd_vector_exec<register_t>>(
+        RAJA::TypedRangeSegment<camp::idx_t>(0, N_r), [=](auto r) {
+          At(c, r) = A(r, c);
+        });
+  }
+
+  for (camp::idx_t r = 0; r < N_r; ++r) {
+    for (camp::idx_t c = 0; c < N_c; ++c) {
+      ASSERT_EQ(At(c, r), A(r, c));
+    }
+  }
+}
+
+TYPED_TEST(VectorViewUnitTest, TypedViewForall)
+{
+  using register_t = TypeParam;
+  using layout = RAJA::TypedLayout<int, camp::tuple<TIY, TIX>>;
+
+  constexpr int N_y = 2;
+  constexpr int N_x = 3 * register_t::num_lanes + 1;
+
+  std::vector<double> a(N_y * N_x), b(N_y * N_x, 0.0);
+  for (int i = 0; i < N_y * N_x; ++i) {
+    a[i] = i;
+  }
+
+  RAJA::TypedView<double, layout, TIY, TIX> A(a.data(), N_y, N_x);
+  RAJA::TypedView<double, layout, TIY, TIX> B(b.data(), N_y, N_x);
+
+  for (int yi = 0; yi < N_y; ++yi) {
+    TIY y(yi);
+    RAJA::forall<RAJA::simd_vector_exec<register_t>>(
+        RAJA::TypedRangeSegment<TIX>(0, N_x),
+        [=](RAJA::VectorIndex<TIX, register_t> x) {
+          B(y, x) = A(y, x);
+          B(y, x) += A(y, x);
+        });
+  }
+
+  for (int i = 0; i < N_y * N_x; ++i) {
+    ASSERT_EQ(b[i], 2.0 * a[i]);
+  }
+}
+
+TYPED_TEST(VectorViewUnitTest, Kernel)
+{
+  using register_t = TypeParam;
+  using layout = RAJA::Layout<2>;
+
+  constexpr camp::idx_t N_r = 3;
+  constexpr camp::idx_t N_c = 2 * register_t::num_lanes + 1;
+
+  std::vector<double> a(N_r * N_c), b(N_r * N_c, 0.0), c(N_r * N_c, 0.0);
+  for (camp::idx_t i = 0; i < N_r * N_c; ++i) {
+    a[i] = i;
+  }
+
+  RAJA::View<double, layout> A(a.data(), N_r, N_c);
+  RAJA::View<double, layout> B(b.data(), N_r, N_c);
+  RAJA::View<double, layout> C(c.data(), N_r, N_c);
+
+  using policy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::seq_exec,
+        RAJA::statement::For<1, RAJA::simd_vector_exec<register_t>,
+          RAJA::statement::Lambda<0>,
+          RAJA::statement::Lambda<1, RAJA::Segs<0, 1>, RAJA::Offsets<1>>
+        >
+      >
+    >;
+
+  RAJA::kernel<policy>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<camp::idx_t>(0, N_r),
+                       RAJA::TypedRangeSegment<camp::idx_t>(0, N_c)),
+      [=](camp::idx_t r, RAJA::VectorIndex<camp::idx_t, register_t> col) {
+        B(r, col) = A(r, col) + 1.0;
+      },
+      [=](camp::idx_t r,
+          RAJA::VectorIndex<camp::idx_t, register_t> col,
+          RAJA::VectorIndex<camp::idx_t, register_t> offset) {
+        ASSERT_EQ(col.begin(), offset.begin());
+        ASSERT_EQ(col.size(), offset.size());
+        C(r, col) = B(r, col) * A(r, col);
+      });
+
+  for (camp::idx_t i = 0; i < N_r * N_c; ++i) {
+    ASSERT_EQ(b[i], a[i] + 1.0);
+    ASSERT_EQ(c[i], (a[i] + 1.0) * a[i]);
+  }
+}